@@ -29,6 +29,9 @@ typedef mapper::ColumnSelect<mapper::kConsoCuidColIndex,    // Col [ 0] -> CUID
                             > ConsoSelector;                // <ConsoSelector> policy // NOLINT
 // clang-format on
 
+/// MRCONSO rows are pipe-delimited & only tokenised up to the last of the `ConsoColumns` we consume
+typedef mapper::VectorDelimiter<'|', builder::ConsoColumns> ConsoDelimiter;
+
 /// Ensure friend ostream insertion op
 template <typename T>
 concept Streamable = requires(T obj) { std::cout << obj; };
@@ -40,8 +43,9 @@ auto writeRecord(Stream &stream, const T &obj) -> void {
 }
 
 /// Write container of records to some fstream
-template <typename Container>
-auto writeDocument(const char *filepath, const Container &rows) -> common::Result {
+///   - each row is first projected to the record it describes, e.g. to resolve its interned component(s)
+template <typename Container, typename Projection>
+auto writeDocument(const char *filepath, const Container &rows, Projection &&project) -> common::Result {
   auto path = std::filesystem::path(filepath);
   if (!path.has_filename() || !path.has_parent_path()) {
     auto msg = path.string();
@@ -54,14 +58,23 @@ auto writeDocument(const char *filepath, const Container &rows) -> common::Resul
   path.replace_extension(ext + kOutfileExt);
 
   auto stream = std::ofstream{path};
-  for (const auto &[key, record] : rows) {
-    writeRecord(stream, record);
+  for (const auto &row : rows) {
+    writeRecord(stream, project(row));
   }
 
   // stream.close();
   return common::Result{common::Status::kSuccessful};
 }
 
+/// Write container of key-value pairs to some fstream
+template <typename Container>
+auto writeDocument(const char *filepath, const Container &rows) -> common::Result {
+  return writeDocument(filepath, rows, [](const auto &row) -> const auto & {
+    const auto &[key, record] = row;
+    return record;
+  });
+}
+
 /************************************************************
  *                                                          *
  *                         Document                         *
@@ -69,13 +82,20 @@ auto writeDocument(const char *filepath, const Container &rows) -> common::Resul
  ************************************************************/
 
 builder::Document::Document(Options opts)
-    : sctTarget_(std::move(opts.sctTarget)), meshTarget_(std::move(opts.meshTarget)) {
+    : sctTarget_(std::move(opts.sctTarget))
+    , meshTarget_(std::move(opts.meshTarget))
+    , meshQualTarget_(std::move(opts.meshQualTarget))
+    , meshSuppTarget_(std::move(opts.meshSuppTarget))
+    , vocabularies_(std::move(opts.vocabularies)) {
   result_ = generate();
 };
 
 auto builder::Document::Build(Options opts) -> bool {
-  sctTarget_  = std::move(opts.sctTarget);
-  meshTarget_ = std::move(opts.meshTarget);
+  sctTarget_      = std::move(opts.sctTarget);
+  meshTarget_     = std::move(opts.meshTarget);
+  meshQualTarget_ = std::move(opts.meshQualTarget);
+  meshSuppTarget_ = std::move(opts.meshSuppTarget);
+  vocabularies_   = std::move(opts.vocabularies);
 
   result_ = generate();
   return result_.Ok();
@@ -105,7 +125,16 @@ auto builder::Document::generate() -> common::Result {
   // MeSH
   auto mesh_doc = std::shared_ptr<mesh::MeshDocument>{nullptr};
   if (!meshTarget_.empty()) {
-    mesh_doc = mesh::MeshDocument::Load(meshTarget_.c_str());
+    auto sources = mesh::MeshSources{.descriptors = meshTarget_.c_str()};
+    if (!meshQualTarget_.empty()) {
+      sources.qualifiers = meshQualTarget_.c_str();
+    }
+
+    if (!meshSuppTarget_.empty()) {
+      sources.supplementals = meshSuppTarget_.c_str();
+    }
+
+    mesh_doc = mesh::MeshDocument::Load(sources, mesh::MeshLoadMode::kStreaming);
     if (!mesh_doc->Ok()) {
       return mesh_doc->GetResult();
     }
@@ -117,21 +146,26 @@ auto builder::Document::generate() -> common::Result {
   }
 
   // MRCONSO
-  auto filter = mapper::LambdaFilter([mesh_doc](mapper::SctRow &row) -> bool {
-    return builder::consoFilter(row, mesh_doc);
-  });
+  auto sources = mapper::SourceClassifier::Parse(vocabularies_);
+  if (!sources.has_value()) {
+    return sources.error();
+  }
 
-  auto map_doc = mapper::SctDocument<mapper::ColumnDelimiter<'|'>,                // Columns delimited by pipe
-                                     mapper::RowFilter<filter>,                   // Filter rows by lang
+  auto filter = builder::ConsoFilter{std::move(sources.value()), std::move(mesh_doc)};
+
+  auto map_doc = mapper::SctDocument<ConsoDelimiter,                              // Columns delimited by pipe
+                                     builder::ConsoFilter,                        // Filter rows by lang & SAB
                                      ConsoSelector,                               // Select CUID, SAB & CODE
                                      mapper::SctSelector<builder::consoCheck>,    // Ensure unique record
                                      mapper::RecordBuilder<builder::consoRecord>  // Build Conso record
-                                     >::Load(sctTarget_.c_str());
+                                     >::Load(sctTarget_.c_str(), std::move(filter), mapper::SctLoadMode::kStreaming);
   if (!map_doc->Ok()) {
     return map_doc->GetResult();
   }
 
-  auto result = writeDocument(sctTarget_.c_str(), map_doc->GetRecords());
+  auto result = writeDocument(sctTarget_.c_str(), map_doc->GetRecords(), [&map_doc](const auto &record) {
+    return map_doc->Resolve(record);
+  });
   if (!result) {
     return result;
   }
@@ -10,8 +10,11 @@ namespace builder {
 class Document final {
 private:
   struct Options {
-    std::string sctTarget;   /// Sct file target
-    std::string meshTarget;  /// Mesh file target
+    std::string sctTarget;       /// Sct file target
+    std::string meshTarget;      /// Mesh file target
+    std::string meshQualTarget;  /// Mesh qualifier file target, optional
+    std::string meshSuppTarget;  /// Mesh supplementary concept file target, optional
+    std::string vocabularies;    /// Target vocabulary spec, see `mapper::SourceClassifier::Parse()`, optional
   };
 
 public:
@@ -45,9 +48,12 @@ private:
   auto generate() -> common::Result;
 
 private:
-  std::string    sctTarget_;   /// Sct file target
-  std::string    meshTarget_;  /// MeSH file target
-  common::Result result_;      /// Document generation result
+  std::string    sctTarget_;       /// Sct file target
+  std::string    meshTarget_;      /// MeSH file target
+  std::string    meshQualTarget_;  /// MeSH qualifier file target
+  std::string    meshSuppTarget_;  /// MeSH supplementary concept file target
+  std::string    vocabularies_;    /// Target vocabulary spec
+  common::Result result_;          /// Document generation result
 };
 
 }  // namespace builder
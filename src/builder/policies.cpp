@@ -1,8 +1,13 @@
 #include "termspp/builder/policies.hpp"
+#include "termspp/mapper/index.hpp"
 
-#include <regex>
+#include <algorithm>
+#include <array>
+#include <utility>
 
 namespace builder = ::termspp::builder;
+namespace mapper  = ::termspp::mapper;
+namespace mesh    = ::termspp::mesh;
 
 /************************************************************
  *                                                          *
@@ -11,84 +16,127 @@ namespace builder = ::termspp::builder;
  ************************************************************/
 
 const char *const builder::kMeshType = "MSH";
-const auto builder::kCodingPattern   = std::regex{"^(SNOMED(?!.*?VET$))|^(MSH)"};
 
-auto builder::consoFilter(mapper::SctRow &row, std::shared_ptr<mesh::MeshDocument> mesh_doc) -> bool {
-  // Ignore empty
-  auto cols = row.cols;
-  if (cols.size() < mapper::kConsoColumnWidth) {
-    return true;
+/// Describes how some MRCONSO row is handled by `consoFilter()`
+enum class ConsoVerdict : uint8_t {
+  kKeep,    // Row is retained
+  kIgnore,  // Row is filtered
+  kProbe,   // MeSH row, filtered if its code exists within the MeSH document
+};
+
+/// Classify some MRCONSO row by its language, suppression & source
+auto consoVerdict(const mapper::SctRow &row, const mapper::SourceClassifier &sources, bool has_mesh)
+  -> ConsoVerdict {
+  // Ignore empty, i.e. rows that end before the last projected column
+  const auto &cols = row.cols;
+  if (cols.Size() < builder::ConsoColumns::kWidth) {
+    return ConsoVerdict::kIgnore;
   }
 
   // Ignore non-English & any obsolete rows
-  if (cols.at(mapper::kConsoLangColIndex) != "ENG" || cols.at(mapper::kConsoSuppressColIndex) == "O") {
-    return true;
+  if (cols[mapper::kConsoLangColIndex] != "ENG" || cols[mapper::kConsoSuppressColIndex] == "O") {
+    return ConsoVerdict::kIgnore;
   }
 
-  // Ignore any row that doesn't reference SCT / MeSH terms
-  auto code = cols.at(mapper::kConsoTargetColIndex);
-  auto sab  = cols.at(mapper::kConsoSourceColIndex);
+  // Ignore any row that doesn't reference a target vocabulary, e.g. SCT / MeSH terms
+  auto code = cols[mapper::kConsoTargetColIndex];
+  auto sab  = cols[mapper::kConsoSourceColIndex];
   if (sab.length() < 1 || code.length() < 3) {
-    return true;
+    return ConsoVerdict::kIgnore;
   }
 
-  std::cmatch coding;
-  auto matched = std::regex_search(std::begin(sab), std::end(sab), coding, kCodingPattern);
-  if (mesh_doc == nullptr) {
-    return !matched;
+  const auto source = sources.Classify(sab);
+  if (source == mapper::SourceClassifier::kUnclassified) {
+    return ConsoVerdict::kIgnore;
   }
 
-  if (!matched) {
-    return true;
+  if (has_mesh && sources.Get(source).prefix == builder::kMeshType) {
+    return ConsoVerdict::kProbe;
   }
 
-  if (std::strncmp(sab.data(), kMeshType, 3) == 0) {
-    auto term = std::string{code.data(), code.length()};
-    return mesh_doc->HasIdentifier(term);
+  return ConsoVerdict::kKeep;
+}
+
+auto builder::consoFilter(mapper::SctRow                     &row,
+                          const mapper::SourceClassifier     &sources,
+                          std::shared_ptr<mesh::MeshDocument> mesh_doc) -> bool {
+  const auto verdict = consoVerdict(row, sources, mesh_doc != nullptr);
+  if (verdict == ConsoVerdict::kProbe) {
+    return mesh_doc->HasIdentifier(row.cols[mapper::kConsoTargetColIndex]);
   }
 
-  return false;
+  return verdict == ConsoVerdict::kIgnore;
 };
 
-auto builder::consoCheck(const mapper::SctRow &row, const mapper::RecordSct &records) -> bool {
-  auto cols = row.cols;
-  if (cols.size() < 3 || row.size < 1) {
-    return false;
-  }
+auto builder::consoFilterBatch(std::span<mapper::SctRow>                  rows,
+                               std::span<bool>                            filtered,
+                               const mapper::SourceClassifier            &sources,
+                               const std::shared_ptr<mesh::MeshDocument> &mesh_doc) -> void {
+  auto uids      = std::array<mesh::MeshUid, mapper::kFilterBatchSize>{};
+  auto positions = std::array<size_t, mapper::kFilterBatchSize>{};
+  auto found     = std::array<bool, mapper::kFilterBatchSize>{};
+  for (size_t offset = 0; offset < rows.size(); offset += mapper::kFilterBatchSize) {
+    const auto length = std::min(mapper::kFilterBatchSize, rows.size() - offset);
+
+    // Classify each row, collecting the MeSH code(s) to be probed
+    size_t count{0};
+    for (size_t index = offset; index < offset + length; ++index) {
+      const auto verdict = consoVerdict(rows[index], sources, mesh_doc != nullptr);
+      filtered[index]    = verdict == ConsoVerdict::kIgnore;
+      if (verdict != ConsoVerdict::kProbe) {
+        continue;
+      }
+
+      // Retain codes that aren't MeSH UIDs, i.e. they can't exist within the document
+      const auto uid = mesh::MeshUid::FromString(rows[index].cols[mapper::kConsoTargetColIndex]);
+      if (uid.Valid()) {
+        uids[count]      = uid;
+        positions[count] = index;
+        count++;
+      }
+    }
 
-  if (records.contains(mapper::RecordLookup{cols.at(0), cols.at(1), cols.at(2)})) {
-    return false;
+    if (count < 1) {
+      continue;
+    }
+
+    // Probe the MeSH code(s) of the block together
+    mesh_doc->HasIdentifiers(std::span{uids.data(), count}, std::span{found.data(), count});
+    for (size_t index = 0; index < count; ++index) {
+      filtered[positions[index]] = found[index];
+    }
   }
+}
 
-  return true;
+builder::ConsoFilter::ConsoFilter(mapper::SourceClassifier sources, std::shared_ptr<mesh::MeshDocument> mesh_doc)
+    : sources_(std::move(sources))
+    , meshDoc_(std::move(mesh_doc)) {}
+
+auto builder::ConsoFilter::FilterBatch(std::span<mapper::SctRow> rows, std::span<bool> filtered) const -> void {
+  builder::consoFilterBatch(rows, filtered, sources_, meshDoc_);
 }
 
-auto builder::consoRecord(const mapper::SctCols &cols, uint8_t *ptr, mapper::SctRecord &record) -> bool {
-  size_t length{0};
-  size_t offset{0};
-  for (auto [iter, end, index] = std::tuple{cols.begin(), cols.end(), 0}; iter != end; ++iter, ++index) {
-    length = iter->length();
-
-    auto origin = offset;
-    std::memcpy(ptr + offset, iter->data(), length);
-    ptr[offset + length++] = '\0';
-
-    switch (index) {
-    case 0:
-      record.uidBuf = reinterpret_cast<char *>(ptr + origin);
-      break;
-    case 1:
-      record.srcBuf = reinterpret_cast<char *>(ptr + origin);
-      break;
-    case 2:
-      record.trgBuf = reinterpret_cast<char *>(ptr + origin);
-      break;
-    default:
-      return false;
-    }
+auto builder::consoCheck(const mapper::SctRecord &record, const mapper::RecordIndex &index) -> bool {
+  return !index.Contains(record);
+}
 
-    offset += length;
+auto builder::consoRecord(const mapper::SctCols &cols, mapper::SctStrings &strings, mapper::SctRecord &record)
+  -> bool {
+  if (cols.Size() != 3 || !mapper::EncodeCui(cols[0], record.uid)) {
+    return false;
+  }
+
+  const auto source = strings.sources.Intern(cols[1]);
+  if (source > mapper::kMaxSourceId) {
+    return false;
+  }
+
+  const auto target = strings.codes.Intern(cols[2]);
+  if (target == mapper::StringPool::kInvalidId) {
+    return false;
   }
 
+  record.src = static_cast<uint16_t>(source);
+  record.trg = target;
   return true;
 }
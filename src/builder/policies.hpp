@@ -1,27 +1,64 @@
 #pragma once
 
+#include "termspp/mapper/classifier.hpp"
 #include "termspp/mapper/defs.hpp"
 #include "termspp/mesh/parser.hpp"
 
-#include <regex>
+#include <memory>
+#include <span>
 
 namespace termspp {
 namespace builder {
 
+// clang-format off
+/// MRCONSO column(s) consumed by our policies
+typedef mapper::ColumnProjection<mapper::kConsoCuidColIndex,      // Col [ 0] -> CUID
+                                 mapper::kConsoLangColIndex,      // Col [ 1] -> LAT
+                                 mapper::kConsoSourceColIndex,    // Col [11] -> SAB
+                                 mapper::kConsoTargetColIndex,    // Col [13] -> CODE/TERM
+                                 mapper::kConsoSuppressColIndex   // Col [16] -> SUPPRESS
+                                > ConsoColumns;                   // <ConsoColumns> projection
+// clang-format on
+
 /// MeSH coding system const.
 extern const char *const kMeshType;
 
-/// Regex pattern describing the appearance of coding system values in the SAB columns
-extern const std::regex kCodingPattern;
-
 /// RowFilter: filters the `MRCONSO.RRF` definition file row(s)
-auto consoFilter(termspp::mapper::SctRow &row, std::shared_ptr<termspp::mesh::MeshDocument> mesh_doc) -> bool;
+///   - rows whose SAB doesn't belong to any of the target vocabularies described by `sources` are ignored
+auto consoFilter(termspp::mapper::SctRow                     &row,
+                 const termspp::mapper::SourceClassifier     &sources,
+                 std::shared_ptr<termspp::mesh::MeshDocument> mesh_doc) -> bool;
+
+/// Batched RowFilter: filters a block of `MRCONSO.RRF` row(s) alike `consoFilter()`
+///   - the MeSH code(s) of the block are probed together, see `MeshDocument::HasIdentifiers()`
+///   - `filtered` is expected to be sized to at least `rows.size()`
+auto consoFilterBatch(std::span<termspp::mapper::SctRow>                   rows,
+                      std::span<bool>                                      filtered,
+                      const termspp::mapper::SourceClassifier             &sources,
+                      const std::shared_ptr<termspp::mesh::MeshDocument> &mesh_doc) -> void;
+
+/// FilterPolicy: filters blocks of `MRCONSO.RRF` row(s) by `consoFilterBatch()`
+///   - owns the target vocabularies & MeSH document of a single `Document::Build()`, i.e. it's passed to & owned by
+///     the `SctDocument` it filters rather than being captured statically
+class ConsoFilter final {
+public:
+  ConsoFilter(termspp::mapper::SourceClassifier sources, std::shared_ptr<termspp::mesh::MeshDocument> mesh_doc);
+
+  /// Flag each row of a block that's to be filtered; safe to call concurrently
+  auto FilterBatch(std::span<termspp::mapper::SctRow> rows, std::span<bool> filtered) const -> void;
+
+private:
+  termspp::mapper::SourceClassifier            sources_;  /// Target vocabularies
+  std::shared_ptr<termspp::mesh::MeshDocument> meshDoc_;  /// MeSH document filtering MeSH row(s), if any
+};
 
-/// SctPolicy: ensure row is unique across its key-value pair
-auto consoCheck(const termspp::mapper::SctRow &row, const termspp::mapper::RecordSct &records) -> bool;
+/// SctPolicy: ensure record is unique across its (CUI, SAB, CODE) components
+auto consoCheck(const termspp::mapper::SctRecord &record, const termspp::mapper::RecordIndex &index) -> bool;
 
-/// BuilderPolicy: builds a record map from a row of columns as parsed/selected by our policies
-auto consoRecord(const termspp::mapper::SctCols &cols, uint8_t *ptr, termspp::mapper::SctRecord &record) -> bool;
+/// BuilderPolicy: builds a record from a row of columns as parsed/selected by our policies, interning its components
+auto consoRecord(const termspp::mapper::SctCols &cols,
+                 termspp::mapper::SctStrings &strings,
+                 termspp::mapper::SctRecord &record) -> bool;
 
 }  // namespace builder
 }  // namespace termspp
@@ -0,0 +1,350 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace termspp {
+namespace common {
+
+/// Open-addressing multimap
+///   - Keys are indexed by a Robin Hood hash table whose slots reference a group of values, i.e. every value
+///     associated with some key is stored contiguously such that a lookup resolves to a single `std::span`
+///   - Groups are laid out in order of their key's first insertion; growing a group that isn't at the tail of
+///     the value array relocates it, the space left behind can be reclaimed by calling `Compact()`
+///   - Iteration yields each key-value pair in order of the key's first insertion, followed by the order in
+///     which the values were inserted
+///
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatMultiMap final {
+  /// Slot sentinel describing an empty slot
+  static constexpr const uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+
+  /// Minimum number of slots allocated by the table
+  static constexpr const size_t kMinSlots = 16U;
+
+  /// Maximum load factor of the table, i.e. `kMaxLoadNum / kMaxLoadDen`
+  static constexpr const size_t kMaxLoadNum = 7U;
+  static constexpr const size_t kMaxLoadDen = 8U;
+
+  /// Minimum capacity of a relocated group
+  static constexpr const uint32_t kMinGroupCapacity = 4U;
+
+  /// Describes a table slot
+  struct Slot {
+    uint32_t group;  // Index of the group referenced by this slot
+    uint32_t hash;   // Truncated hash of the group's key
+  };
+
+  /// Describes the contiguous value(s) associated with a key
+  struct Group {
+    Key      key;       // Group key
+    uint32_t hash;      // Truncated hash of the key
+    uint32_t offset;    // Offset of the group's first value
+    uint32_t count;     // Number of values contained by the group; erased groups are empty
+    uint32_t capacity;  // Number of values reserved for the group
+  };
+
+public:
+  /// Describes a key-value pair, used for structured binding whilst iterating
+  struct Entry {
+    const Key   &key;
+    const Value &value;
+  };
+
+  /// Forward iterator across all key-value pairs
+  class Iterator {
+  public:
+    Iterator(const FlatMultiMap *map, size_t group, size_t index) : map_(map), group_(group), index_(index) {
+      skip();
+    }
+
+    auto operator*() const->Entry {
+      const auto &group = map_->groups_[group_];
+      return Entry{group.key, map_->values_[group.offset + index_]};
+    }
+
+    auto operator++()->Iterator & {
+      index_++;
+      skip();
+      return *this;
+    }
+
+    auto operator==(const Iterator &other) const->bool {
+      return group_ == other.group_ && index_ == other.index_;
+    }
+
+  private:
+    /// Advance past exhausted & erased group(s)
+    auto skip() -> void {
+      while (group_ < map_->groups_.size() && index_ >= map_->groups_[group_].count) {
+        group_++;
+        index_ = 0;
+      }
+    }
+
+  private:
+    const FlatMultiMap *map_;
+    size_t              group_;
+    size_t              index_;
+  };
+
+public:
+  FlatMultiMap() = default;
+
+  /// Insert a value associated with the given key
+  auto Insert(const Key &key, const Value &value) -> void {
+    auto index = findGroup(key);
+    if (index == kEmptySlot) {
+      if ((live_ + 1) * kMaxLoadDen > slots_.size() * kMaxLoadNum) {
+        rehash(std::max(kMinSlots, slots_.size() * 2));
+      }
+
+      const auto hash = hashKey(key);
+      index           = static_cast<uint32_t>(groups_.size());
+      groups_.emplace_back(Group{key, hash, static_cast<uint32_t>(values_.size()), 0, 0});
+      insertSlot(Slot{index, hash});
+      live_++;
+    }
+
+    appendValue(groups_[index], value);
+    size_++;
+  }
+
+  /// Find the value(s) associated with the given key
+  [[nodiscard]] auto Find(const Key &key) const -> std::span<const Value> {
+    const auto index = findGroup(key);
+    if (index == kEmptySlot) {
+      return {};
+    }
+
+    const auto &group = groups_[index];
+    return std::span<const Value>{values_.data() + group.offset, group.count};
+  }
+
+  /// Test whether the given key is associated with any value(s)
+  [[nodiscard]] auto Contains(const Key &key) const -> bool {
+    return findGroup(key) != kEmptySlot;
+  }
+
+  /// Erase every value associated with the given key, returning the number of values erased
+  auto Erase(const Key &key) -> size_t {
+    return EraseIf(key, [](const Value &) {
+      return true;
+    });
+  }
+
+  /// Erase the value(s) associated with the given key that satisfy some predicate
+  ///   - the relative order of the remaining value(s) is preserved
+  template <typename Predicate>
+  auto EraseIf(const Key &key, Predicate &&pred) -> size_t {
+    const auto position = findSlot(key);
+    if (position == kEmptySlot) {
+      return 0;
+    }
+
+    auto &group = groups_[slots_[position].group];
+    auto *beg   = values_.data() + group.offset;
+    auto *end   = std::remove_if(beg, beg + group.count, std::forward<Predicate>(pred));
+
+    const auto erased = static_cast<size_t>((beg + group.count) - end);
+    group.count       = static_cast<uint32_t>(end - beg);
+    size_            -= erased;
+
+    if (group.count == 0) {
+      eraseSlot(position);
+      live_--;
+    }
+
+    return erased;
+  }
+
+  /// Reserve space for the given number of keys & values
+  auto Reserve(size_t keys, size_t values) -> void {
+    groups_.reserve(keys);
+    values_.reserve(values);
+
+    auto slots = kMinSlots;
+    while (keys * kMaxLoadDen > slots * kMaxLoadNum) {
+      slots *= 2;
+    }
+
+    if (slots > slots_.size()) {
+      rehash(slots);
+    }
+  }
+
+  /// Repack the value(s) such that each group is contiguous & tightly packed, dropping erased keys
+  auto Compact() -> void {
+    auto groups = std::vector<Group>{};
+    auto values = std::vector<Value>{};
+    groups.reserve(live_);
+    values.reserve(size_);
+
+    for (const auto &group : groups_) {
+      if (group.count < 1) {
+        continue;
+      }
+
+      const auto offset = static_cast<uint32_t>(values.size());
+      values.insert(values.end(), values_.begin() + group.offset, values_.begin() + group.offset + group.count);
+      groups.emplace_back(Group{group.key, group.hash, offset, group.count, group.count});
+    }
+
+    groups_ = std::move(groups);
+    values_ = std::move(values);
+    rehash(slots_.size());
+  }
+
+  /// Remove all keys & values
+  auto Clear() -> void {
+    slots_.clear();
+    groups_.clear();
+    values_.clear();
+    live_ = 0;
+    size_ = 0;
+  }
+
+  /// Getter: the number of values contained by this instance
+  [[nodiscard]] auto Size() const -> size_t {
+    return size_;
+  }
+
+  /// Getter: the number of unique keys contained by this instance
+  [[nodiscard]] auto KeyCount() const -> size_t {
+    return live_;
+  }
+
+  /// Getter: whether this instance contains any values
+  [[nodiscard]] auto Empty() const -> bool {
+    return size_ == 0;
+  }
+
+  [[nodiscard]] auto begin() const -> Iterator {
+    return Iterator{this, 0, 0};
+  }
+
+  [[nodiscard]] auto end() const -> Iterator {
+    return Iterator{this, groups_.size(), 0};
+  }
+
+private:
+  /// Hash a key, truncated to the width of a slot
+  [[nodiscard]] static auto hashKey(const Key &key) -> uint32_t {
+    const auto hash = static_cast<uint64_t>(Hash{}(key));
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+  }
+
+  /// Getter: the distance of the slot at the given position from its ideal position
+  [[nodiscard]] auto probeDistance(size_t position) const -> size_t {
+    return (position - (slots_[position].hash & (slots_.size() - 1))) & (slots_.size() - 1);
+  }
+
+  /// Find the position of the slot referencing the given key
+  [[nodiscard]] auto findSlot(const Key &key) const -> uint32_t {
+    if (live_ == 0) {
+      return kEmptySlot;
+    }
+
+    const auto hash     = hashKey(key);
+    const auto mask     = slots_.size() - 1;
+    auto       position = hash & mask;
+    for (size_t distance = 0;; ++distance, position = (position + 1) & mask) {
+      const auto &slot = slots_[position];
+      if (slot.group == kEmptySlot || probeDistance(position) < distance) {
+        return kEmptySlot;
+      }
+
+      if (slot.hash == hash && KeyEqual{}(groups_[slot.group].key, key)) {
+        return static_cast<uint32_t>(position);
+      }
+    }
+  }
+
+  /// Find the index of the group associated with the given key
+  [[nodiscard]] auto findGroup(const Key &key) const -> uint32_t {
+    const auto position = findSlot(key);
+    return position == kEmptySlot ? kEmptySlot : slots_[position].group;
+  }
+
+  /// Insert a slot, displacing any slot closer to its ideal position
+  auto insertSlot(Slot slot) -> void {
+    const auto mask     = slots_.size() - 1;
+    auto       position = slot.hash & mask;
+    for (size_t distance = 0;; ++distance, position = (position + 1) & mask) {
+      if (slots_[position].group == kEmptySlot) {
+        slots_[position] = slot;
+        return;
+      }
+
+      const auto existing = probeDistance(position);
+      if (existing < distance) {
+        std::swap(slot, slots_[position]);
+        distance = existing;
+      }
+    }
+  }
+
+  /// Erase the slot at the given position, shifting its successor(s) backwards
+  auto eraseSlot(size_t position) -> void {
+    const auto mask = slots_.size() - 1;
+    while (true) {
+      const auto next = (position + 1) & mask;
+      if (slots_[next].group == kEmptySlot || probeDistance(next) == 0) {
+        slots_[position] = Slot{kEmptySlot, 0};
+        return;
+      }
+
+      slots_[position] = slots_[next];
+      position         = next;
+    }
+  }
+
+  /// Rebuild the table with the given number of slots
+  auto rehash(size_t size) -> void {
+    slots_.assign(size, Slot{kEmptySlot, 0});
+    for (size_t index = 0; index < groups_.size(); ++index) {
+      if (groups_[index].count > 0) {
+        insertSlot(Slot{static_cast<uint32_t>(index), groups_[index].hash});
+      }
+    }
+  }
+
+  /// Append a value to a group, relocating the group to the tail of the value array if it's exhausted
+  auto appendValue(Group &group, const Value &value) -> void {
+    if (group.count < group.capacity) {
+      values_[group.offset + group.count++] = value;
+      return;
+    }
+
+    if (group.offset + group.count == values_.size()) {
+      values_.emplace_back(value);
+      group.capacity = ++group.count;
+      return;
+    }
+
+    const auto offset   = static_cast<uint32_t>(values_.size());
+    const auto capacity = std::max(kMinGroupCapacity, group.count * 2);
+    values_.resize(values_.size() + capacity);
+    std::copy_n(values_.begin() + group.offset, group.count, values_.begin() + offset);
+
+    group.offset                          = offset;
+    group.capacity                        = capacity;
+    values_[group.offset + group.count++] = value;
+  }
+
+private:
+  std::vector<Slot>  slots_;    /// Hash table slots, sized to a power of two
+  std::vector<Group> groups_;   /// Key groups in order of first insertion
+  std::vector<Value> values_;   /// Contiguous value array
+  size_t             live_{0};  /// Number of non-erased keys
+  size_t             size_{0};  /// Number of values
+};
+
+}  // namespace common
+}  // namespace termspp
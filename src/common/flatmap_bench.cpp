@@ -0,0 +1,125 @@
+#include "termspp/common/flatmap.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Bench defaults, i.e. roughly the number of records described by a MeSH descriptor & supplementary set
+constexpr const size_t kDefaultKeys   = 330000U;
+constexpr const size_t kDefaultProbes = 2000000U;
+
+/// Describes a MeSH-sized value, i.e. a record viewing its text
+struct BenchValue {
+  const char *name;
+  uint32_t    type;
+  uint32_t    offset;
+};
+
+/// Build a MeSH UID, e.g. `D000001` or `C538396`
+auto makeUid(std::mt19937_64 &rng) -> std::string {
+  static constexpr const char kPrefixes[] = {'D', 'D', 'C', 'Q'};
+
+  auto uid = std::string{kPrefixes[rng() % sizeof(kPrefixes)]};
+  auto num = std::to_string(rng() % 10000000U);
+  uid.append(num.length() < 6 ? 6 - num.length() : 0, '0');
+  uid.append(num);
+  return uid;
+}
+
+/// Time some func, returning the elapsed milliseconds
+template <typename Func>
+auto timeMs(Func &&func) -> double {
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/************************************************************
+ *                                                          *
+ *                           Main                           *
+ *                                                          *
+ ************************************************************/
+
+/// Compare the lookup throughput of `FlatMultiMap::Find()` against `std::multimap::equal_range()`
+///   - usage: `flatmap_bench [keys] [probes]`; half of the probes miss
+auto main(int argc, char **argv) -> int {
+  const auto keys   = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultKeys;
+  const auto probes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : kDefaultProbes;
+
+  auto rng     = std::mt19937_64{42};
+  auto entries = std::vector<std::pair<std::string, BenchValue>>{};
+  entries.reserve(keys);
+  for (size_t index = 0; index < keys; ++index) {
+    auto uid = makeUid(rng);
+    entries.emplace_back(uid, BenchValue{nullptr, static_cast<uint32_t>(index % 3), static_cast<uint32_t>(index)});
+  }
+
+  auto lookups = std::vector<std::string>{};
+  lookups.reserve(probes);
+  for (size_t index = 0; index < probes; ++index) {
+    lookups.emplace_back(index % 2 == 0 ? entries[rng() % entries.size()].first : makeUid(rng));
+  }
+
+  // Build
+  auto tree = std::multimap<std::string, BenchValue>{};
+  auto flat = common::FlatMultiMap<std::string, BenchValue>{};
+
+  const auto tree_build = timeMs([&] {
+    for (const auto &[key, value] : entries) {
+      tree.emplace(key, value);
+    }
+  });
+
+  const auto flat_build = timeMs([&] {
+    for (const auto &[key, value] : entries) {
+      flat.Insert(key, value);
+    }
+    flat.Compact();
+  });
+
+  // Probe, accumulating the hits such that the lookups aren't elided
+  size_t tree_hits{0};
+  size_t flat_hits{0};
+
+  const auto tree_probe = timeMs([&] {
+    for (const auto &key : lookups) {
+      const auto [beg, end] = tree.equal_range(key);
+      for (auto iter = beg; iter != end; ++iter) {
+        tree_hits += iter->second.offset;
+      }
+    }
+  });
+
+  const auto flat_probe = timeMs([&] {
+    for (const auto &key : lookups) {
+      for (const auto &value : flat.Find(key)) {
+        flat_hits += value.offset;
+      }
+    }
+  });
+
+  std::printf("keys %zu, probes %zu\n", static_cast<size_t>(keys), static_cast<size_t>(probes));
+  std::printf("%-14s %10s %10s %14s\n", "", "build ms", "probe ms", "probes/s");
+  std::printf("%-14s %10.1f %10.1f %14.0f\n", "std::multimap", tree_build, tree_probe, probes / tree_probe * 1e3);
+  std::printf("%-14s %10.1f %10.1f %14.0f\n", "FlatMultiMap", flat_build, flat_probe, probes / flat_probe * 1e3);
+
+  if (tree_hits != flat_hits) {
+    std::fprintf(stderr, "expected both maps to resolve the same value(s)\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include "termspp/common/mapped.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                        MappedFile                        *
+ *                                                          *
+ ************************************************************/
+
+auto common::MappedFile::Create(const char *filepath)
+  -> nonstd::expected<std::unique_ptr<common::MappedFile>, common::Result> {
+  if (filepath == nullptr) {
+    return nonstd::make_unexpected(common::Result{common::Status::kInvalidArguments});
+  }
+
+  const auto fd = ::open(filepath, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nonstd::make_unexpected(common::Result{common::Status::kFileNotFoundErr, std::strerror(errno)});
+  }
+
+  struct stat info {};
+  if (::fstat(fd, &info) != 0) {
+    auto res = common::Result{common::Status::kFileInitErr, std::strerror(errno)};
+    ::close(fd);
+    return nonstd::make_unexpected(res);
+  }
+
+  const auto size = static_cast<size_t>(info.st_size);
+  if (size == 0) {
+    ::close(fd);
+    return std::unique_ptr<common::MappedFile>(new common::MappedFile(nullptr, 0));
+  }
+
+  auto *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if (data == MAP_FAILED) {
+    return nonstd::make_unexpected(common::Result{common::Status::kFileInitErr, std::strerror(errno)});
+  }
+
+  return std::unique_ptr<common::MappedFile>(new common::MappedFile(static_cast<const char *>(data), size));
+}
+
+auto common::MappedFile::Advise(common::MappedAccess access, size_t offset, size_t length) const -> bool {
+  if (data_ == nullptr || offset >= size_) {
+    return false;
+  }
+
+  int advice{MADV_NORMAL};
+  switch (access) {
+  case common::MappedAccess::kSequential:
+    advice = MADV_SEQUENTIAL;
+    break;
+  case common::MappedAccess::kRandom:
+    advice = MADV_RANDOM;
+    break;
+  case common::MappedAccess::kWillNeed:
+    advice = MADV_WILLNEED;
+    break;
+  default:
+    break;
+  }
+
+  // madvise(2) expects a page-aligned address, the mapping itself always begins on a page boundary
+  const auto page  = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  const auto begin = offset - (offset % page);
+  const auto end   = std::min(size_ - offset, length) + offset;
+
+  auto *addr = const_cast<char *>(data_ + begin);
+  return ::madvise(addr, end - begin, advice) == 0;
+}
+
+common::MappedFile::MappedFile(const char *data, size_t size) : data_(data), size_(size) {}
+
+common::MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char *>(data_), size_);
+  }
+}
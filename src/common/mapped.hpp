@@ -0,0 +1,72 @@
+#pragma once
+
+#include "termspp/common/result.hpp"
+
+#include "nonstd/expected.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace termspp {
+namespace common {
+
+/// Describes the expected access pattern of a mapped region, see `MappedFile::Advise()`
+enum class MappedAccess : uint8_t {
+  kNormal,      // No special treatment
+  kSequential,  // Read once from front to back, i.e. read ahead aggressively & reclaim pages behind the reader
+  kRandom,      // Read in no particular order, i.e. don't read ahead
+  kWillNeed,    // Expected to be read soon, i.e. start paging it in
+};
+
+/// Read-only, memory-mapped view of a file
+///   - the mapping is released when the instance is destroyed, i.e. views handed out by `View()` are only
+///     valid for the lifetime of the instance
+///
+class MappedFile final {
+public:
+  /// Attempt to map the file at the given path into memory
+  static auto Create(const char *filepath) -> nonstd::expected<std::unique_ptr<MappedFile>, Result>;
+
+public:
+  ~MappedFile();
+
+  MappedFile(MappedFile const &)                   = delete;
+  auto operator=(MappedFile const &)->MappedFile & = delete;
+
+  /// Getter: retrieve the beginning of the mapped region
+  [[nodiscard]] auto Data() const -> const char * {
+    return data_;
+  }
+
+  /// Getter: retrieve the size of the mapped region in bytes
+  [[nodiscard]] auto Size() const -> size_t {
+    return size_;
+  }
+
+  /// Getter: retrieve a view of the entire mapped region
+  [[nodiscard]] auto View() const -> std::string_view {
+    return std::string_view{data_, size_};
+  }
+
+  /// Test whether some pointer references the mapped region
+  [[nodiscard]] auto Contains(const char *ptr) const -> bool {
+    return ptr != nullptr && ptr >= data_ && ptr < data_ + size_;
+  }
+
+  /// Hint the kernel as to how some range of the mapped region will be accessed
+  ///   - the range is widened to the enclosing page(s) & clamped to the mapped region
+  ///   - this is advisory only, i.e. returns false if the hint was rejected but the mapping remains usable
+  auto Advise(MappedAccess access, size_t offset = 0, size_t length = std::string_view::npos) const -> bool;
+
+private:
+  const char *data_;
+  size_t      size_;
+
+protected:
+  MappedFile(const char *data, size_t size);
+};
+
+}  // namespace common
+}  // namespace termspp
@@ -21,11 +21,13 @@ enum class Status : uint8_t {
   kAllocationErr,        // Failed to allocate memory
   kNoRowData,            // No row data was parsed for this row
   kPolicyErr,            // User-defined policy execution failure
-  kRootDoesNotExistErr,  // Expected root node described by `mesh::kRecordSetNode` not found in document
+  kRootDoesNotExistErr,  // Expected root node described by `mesh::MeshRecordSet` not found in document
   kNodeDoesNotExistErr,  // Node specified by spec does not exist
   kUnknownNodeTypeErr,   // Node type is not included in expected specification
   kEmptyNodeDataErr,     // Data resolved from node was empty
   kInvalidDataTypeErr,   // Failed to resolve data from node
+  kFileWriteErr,         // Failed to write to file
+  kSnapshotErr,          // Snapshot is malformed, corrupt or was written by an incompatible version
   kSuccessful,           // No error
 };
 
@@ -118,6 +120,12 @@ struct Result {
     case Status::kEmptyNodeDataErr:
       result = "Failed to resolve node data";
       break;
+    case Status::kFileWriteErr:
+      result = "Failed to write file";
+      break;
+    case Status::kSnapshotErr:
+      result = "Failed to read snapshot";
+      break;
     case Status::kUnknownErr:
     default:
       result = "Unknown error occurred whilst processing document";
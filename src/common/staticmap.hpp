@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace termspp {
+namespace common {
+
+/// Compile-time string->value map
+///   - Keys are indexed by a perfect hash whose seed is searched for when the map is constant-evaluated, i.e.
+///     each key occupies its own slot & a lookup is a single hash, a single length check & a single compare
+///   - Neither construction nor lookup allocate, the table is expected to be declared `constexpr` such that
+///     it's embedded within the binary
+///   - Construction fails to compile if the keys contain duplicates, or if no seed could be found
+///
+template <typename Value, size_t N>
+class StaticMap final {
+  /// Number of slots allocated by the table, i.e. a power of two with a load factor of at most 1/2
+  static constexpr const size_t kSlots = std::bit_ceil(N * 2 > 1 ? N * 2 : 2);
+
+  /// Maximum number of seeds attempted before construction fails
+  static constexpr const uint32_t kMaxSeeds = 1U << 16;
+
+  /// Slot sentinel describing an empty slot
+  static constexpr const uint8_t kEmptySlot = 0xFF;
+
+  static_assert(N > 0 && N < kEmptySlot, "expected between 1 and 254 entries");
+
+public:
+  /// Describes a key-value pair
+  typedef std::pair<std::string_view, Value> Entry;
+
+public:
+  consteval explicit StaticMap(const std::array<Entry, N> &entries) : entries_(entries) {
+    for (uint32_t seed = 0; seed < kMaxSeeds; ++seed) {
+      if (tryBuild(seed)) {
+        seed_ = seed;
+        return;
+      }
+    }
+
+    // Not a constant expression, i.e. fails to compile
+    throw "failed to find a perfect hash seed for the given keys";
+  }
+
+  /// Find the value assoc. with the given key, returning `nullptr` if it doesn't exist
+  [[nodiscard]] constexpr auto Find(std::string_view key) const -> const Value * {
+    const auto slot = slots_[hash(key, seed_) & (kSlots - 1)];
+    if (slot == kEmptySlot || entries_[slot].first != key) {
+      return nullptr;
+    }
+
+    return &entries_[slot].second;
+  }
+
+  /// Getter: the value assoc. with the given key, or `fallback` if it doesn't exist
+  [[nodiscard]] constexpr auto Get(std::string_view key, Value fallback) const -> Value {
+    const auto *value = Find(key);
+    return value != nullptr ? *value : fallback;
+  }
+
+  /// Getter: the number of entries contained by this map
+  [[nodiscard]] static constexpr auto Size() -> size_t {
+    return N;
+  }
+
+  /// Iterate across each entry in order of declaration
+  [[nodiscard]] constexpr auto begin() const {
+    return entries_.begin();
+  }
+
+  [[nodiscard]] constexpr auto end() const {
+    return entries_.end();
+  }
+
+private:
+  /// Seeded FNV-1a over the key, mixed by its length
+  [[nodiscard]] static constexpr auto hash(std::string_view key, uint32_t seed) -> size_t {
+    uint64_t value = 0xCBF29CE484222325ULL ^ (static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ULL);
+    for (const auto chr : key) {
+      value = (value ^ static_cast<uint8_t>(chr)) * 0x100000001B3ULL;
+    }
+
+    value ^= key.size();
+    value ^= value >> 29;
+    return static_cast<size_t>(value);
+  }
+
+  /// Attempt to place every entry into its own slot using the given seed
+  constexpr auto tryBuild(uint32_t seed) -> bool {
+    slots_.fill(kEmptySlot);
+    for (size_t index = 0; index < N; ++index) {
+      auto &slot = slots_[hash(entries_[index].first, seed) & (kSlots - 1)];
+      if (slot != kEmptySlot) {
+        return false;
+      }
+      slot = static_cast<uint8_t>(index);
+    }
+
+    return true;
+  }
+
+private:
+  std::array<Entry, N>        entries_{};  /// Declared entries
+  std::array<uint8_t, kSlots> slots_{};    /// Slot->entry index table
+  uint32_t                    seed_{0};    /// Perfect hash seed
+};
+
+}  // namespace common
+}  // namespace termspp
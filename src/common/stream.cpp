@@ -0,0 +1,406 @@
+#include "termspp/common/stream.hpp"
+
+#include "termspp/common/scope.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Compression magic byte(s)
+constexpr const std::string_view kGzipMagic{"\x1F\x8B", 2};
+constexpr const std::string_view kZstdMagic{"\x28\xB5\x2F\xFD", 4};
+
+/// Number of leading byte(s) read to detect the compression format
+constexpr const size_t kMagicSize{4U};
+
+/// zlib window size, i.e. max. window with automatic gzip/zlib header detection
+constexpr const int kGzipWindowBits{15 + 32};
+
+/// Read from some file descriptor, retrying if interrupted
+auto readDescriptor(int fd, char *out, size_t size) -> ssize_t {
+  ssize_t read{0};
+  do {
+    read = ::read(fd, out, size);
+  } while (read < 0 && errno == EINTR);
+
+  return read;
+}
+
+/// Read the leading byte(s) of some file descriptor, i.e. until `kMagicSize` bytes are read or the input ends
+auto readHead(int fd, std::string &head) -> bool {
+  char buffer[kMagicSize];
+  while (head.size() < kMagicSize) {
+    const auto read = readDescriptor(fd, buffer, kMagicSize - head.size());
+    if (read < 0) {
+      return false;
+    }
+
+    if (read == 0) {
+      break;
+    }
+
+    head.append(buffer, static_cast<size_t>(read));
+  }
+
+  return true;
+}
+
+auto common::DetectCompression(std::string_view head) -> common::Compression {
+  if (head.starts_with(kGzipMagic)) {
+    return common::Compression::kGzip;
+  }
+
+  if (head.starts_with(kZstdMagic)) {
+    return common::Compression::kZstd;
+  }
+
+  return common::Compression::kNone;
+}
+
+/************************************************************
+ *                                                          *
+ *                       InputStream                        *
+ *                                                          *
+ ************************************************************/
+
+common::InputStream::InputStream(int                 fd,
+                                 bool                owned,
+                                 common::Compression compression,
+                                 std::string         head,
+                                 size_t              blockSize)
+    : fd_(fd)
+    , owned_(owned)
+    , compression_(compression)
+    , head_(std::move(head))
+    , blockSize_(std::max<size_t>(blockSize, 1)) {
+  for (auto &buffer : buffers_) {
+    buffer.resize(blockSize_);
+  }
+
+  worker_ = std::thread(&common::InputStream::produce, this);
+}
+
+common::InputStream::~InputStream() {
+  {
+    auto lock = std::unique_lock{mutex_};
+    stop_     = true;
+  }
+  cond_.notify_all();
+
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+
+  if (owned_) {
+    ::close(fd_);
+  }
+}
+
+auto common::InputStream::Open(const char *filepath, size_t blockSize)
+  -> nonstd::expected<std::unique_ptr<common::InputStream>, common::Result> {
+  if (filepath == nullptr) {
+    return nonstd::make_unexpected(common::Result{common::Status::kInvalidArguments});
+  }
+
+  const auto is_stdin = std::string_view{filepath} == kStdinPath;
+  const auto fd       = is_stdin ? STDIN_FILENO : ::open(filepath, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nonstd::make_unexpected(common::Result{common::Status::kFileNotFoundErr, std::strerror(errno)});
+  }
+
+  auto head = std::string{};
+  if (!readHead(fd, head)) {
+    auto res = common::Result{common::Status::kFileInitErr, std::strerror(errno)};
+    if (!is_stdin) {
+      ::close(fd);
+    }
+
+    return nonstd::make_unexpected(res);
+  }
+
+  const auto compression = common::DetectCompression(head);
+  return std::unique_ptr<common::InputStream>(
+    new common::InputStream(fd, !is_stdin, compression, std::move(head), blockSize));
+}
+
+auto common::InputStream::IsMappable(const char *filepath) -> bool {
+  if (!IsRereadable(filepath)) {
+    return false;
+  }
+
+  const auto fd = ::open(filepath, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  auto head = std::string{};
+  auto read = readHead(fd, head);
+  ::close(fd);
+
+  return read && common::DetectCompression(head) == common::Compression::kNone;
+}
+
+auto common::InputStream::IsRereadable(const char *filepath) -> bool {
+  if (filepath == nullptr || std::string_view{filepath} == kStdinPath) {
+    return false;
+  }
+
+  struct stat info {};
+  return ::stat(filepath, &info) == 0 && S_ISREG(info.st_mode);
+}
+
+auto common::InputStream::Next(std::string_view &block) -> bool {
+  auto lock = std::unique_lock{mutex_};
+
+  // Release the previous block back to the reader
+  if (holding_) {
+    full_[held_] = false;
+    holding_     = false;
+    cond_.notify_all();
+  }
+
+  cond_.wait(lock, [this] {
+    return full_[read_] || done_;
+  });
+
+  if (!full_[read_]) {
+    return false;
+  }
+
+  block    = std::string_view{buffers_[read_].data(), sizes_[read_]};
+  held_    = read_;
+  holding_ = true;
+  read_    = (read_ + 1) % kBufferCount;
+  return true;
+}
+
+auto common::InputStream::GetResult() -> common::Result {
+  auto lock = std::unique_lock{mutex_};
+  return result_;
+}
+
+auto common::InputStream::produce() -> void {
+  auto result = common::Result{common::Status::kSuccessful};
+  switch (compression_) {
+  case common::Compression::kGzip:
+    result = decodeGzip();
+    break;
+  case common::Compression::kZstd:
+    result = decodeZstd();
+    break;
+  case common::Compression::kNone:
+  default:
+    result = decodeRaw();
+    break;
+  }
+
+  // Publish the remainder of the input, even on err, such that the consumer may drain it
+  publish();
+
+  {
+    auto lock = std::unique_lock{mutex_};
+    result_   = result;
+    done_     = true;
+  }
+  cond_.notify_all();
+}
+
+auto common::InputStream::decodeRaw() -> common::Result {
+  while (true) {
+    const auto out = acquire();
+    if (out.empty()) {
+      break;
+    }
+
+    const auto read = readInput(out.data(), out.size());
+    if (!read.has_value()) {
+      return read.error();
+    }
+
+    if (read.value() == 0) {
+      break;
+    }
+
+    commit(read.value());
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto common::InputStream::decodeGzip() -> common::Result {
+  auto stream = z_stream{};
+  if (inflateInit2(&stream, kGzipWindowBits) != Z_OK) {
+    return common::Result{common::Status::kFileInitErr, "failed to initialise gzip decoder"};
+  }
+
+  auto cleanup = common::ScopedDeleter(&stream, [](z_stream *ptr) {
+    inflateEnd(ptr);
+  });
+
+  auto input  = std::vector<char>(kInputSize);
+  auto is_eof = false;
+  auto ended  = false;  // Whether the current member has ended, i.e. any further input begins a new member
+  while (true) {
+    if (stream.avail_in == 0 && !is_eof) {
+      const auto read = readInput(input.data(), input.size());
+      if (!read.has_value()) {
+        return read.error();
+      }
+
+      is_eof          = read.value() == 0;
+      stream.next_in  = reinterpret_cast<Bytef *>(input.data());
+      stream.avail_in = static_cast<uInt>(read.value());
+    }
+
+    if (stream.avail_in == 0) {
+      if (!ended) {
+        return common::Result{common::Status::kLineReaderErr, "unexpected end of gzip stream"};
+      }
+      break;
+    }
+
+    // Concatenated member(s)
+    if (ended) {
+      inflateReset(&stream);
+      ended = false;
+    }
+
+    const auto out = acquire();
+    if (out.empty()) {
+      break;
+    }
+
+    stream.next_out  = reinterpret_cast<Bytef *>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+
+    const auto status = inflate(&stream, Z_NO_FLUSH);
+    if (status == Z_STREAM_END) {
+      ended = true;
+    } else if (status != Z_OK && status != Z_BUF_ERROR) {
+      const auto *msg = stream.msg != nullptr ? stream.msg : "malformed gzip stream";
+      return common::Result{common::Status::kLineReaderErr, msg};
+    }
+
+    commit(out.size() - stream.avail_out);
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto common::InputStream::decodeZstd() -> common::Result {
+  auto cleanup = common::ScopedDeleter(ZSTD_createDCtx(), [](ZSTD_DCtx *ptr) {
+    ZSTD_freeDCtx(ptr);
+  });
+
+  auto *context = cleanup.GetResource();
+  if (context == nullptr) {
+    return common::Result{common::Status::kFileInitErr, "failed to initialise zstd decoder"};
+  }
+
+  auto   input  = std::vector<char>(std::max(kInputSize, ZSTD_DStreamInSize()));
+  auto   buffer = ZSTD_inBuffer{.src = input.data(), .size = 0, .pos = 0};
+  auto   is_eof = false;
+  size_t hint{0};  // Zero once the current frame has been fully decoded & flushed
+  while (true) {
+    if (buffer.pos == buffer.size && !is_eof) {
+      const auto read = readInput(input.data(), input.size());
+      if (!read.has_value()) {
+        return read.error();
+      }
+
+      is_eof = read.value() == 0;
+      buffer = ZSTD_inBuffer{.src = input.data(), .size = read.value(), .pos = 0};
+    }
+
+    if (buffer.pos == buffer.size && is_eof) {
+      if (hint != 0) {
+        return common::Result{common::Status::kLineReaderErr, "unexpected end of zstd stream"};
+      }
+      break;
+    }
+
+    const auto out = acquire();
+    if (out.empty()) {
+      break;
+    }
+
+    auto output = ZSTD_outBuffer{.dst = out.data(), .size = out.size(), .pos = 0};
+    hint        = ZSTD_decompressStream(context, &output, &buffer);
+    if (ZSTD_isError(hint) != 0) {
+      return common::Result{common::Status::kLineReaderErr, ZSTD_getErrorName(hint)};
+    }
+
+    commit(output.pos);
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto common::InputStream::readInput(char *out, size_t size) -> nonstd::expected<size_t, common::Result> {
+  if (!head_.empty()) {
+    const auto length = std::min(size, head_.size());
+    std::memcpy(out, head_.data(), length);
+    head_.erase(0, length);
+    return length;
+  }
+
+  const auto read = readDescriptor(fd_, out, size);
+  if (read < 0) {
+    return nonstd::make_unexpected(common::Result{common::Status::kLineReaderErr, std::strerror(errno)});
+  }
+
+  return static_cast<size_t>(read);
+}
+
+auto common::InputStream::acquire() -> std::span<char> {
+  if (fill_ == 0) {
+    auto lock = std::unique_lock{mutex_};
+    cond_.wait(lock, [this] {
+      return !full_[write_] || stop_;
+    });
+
+    if (stop_) {
+      return {};
+    }
+  }
+
+  return std::span<char>{buffers_[write_].data() + fill_, blockSize_ - fill_};
+}
+
+auto common::InputStream::commit(size_t size) -> void {
+  fill_ += size;
+  if (fill_ >= blockSize_) {
+    publish();
+  }
+}
+
+auto common::InputStream::publish() -> void {
+  if (fill_ == 0) {
+    return;
+  }
+
+  {
+    auto lock      = std::unique_lock{mutex_};
+    sizes_[write_] = fill_;
+    full_[write_]  = true;
+  }
+  cond_.notify_all();
+
+  write_ = (write_ + 1) % kBufferCount;
+  fill_  = 0;
+}
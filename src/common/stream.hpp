@@ -0,0 +1,135 @@
+#pragma once
+
+#include "termspp/common/result.hpp"
+
+#include "nonstd/expected.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace termspp {
+namespace common {
+
+/// Compression format(s) accepted by `InputStream`
+enum class Compression : uint8_t {
+  kNone,  // Uncompressed
+  kGzip,  // gzip, incl. concatenated members, i.e. `.gz`
+  kZstd,  // Zstandard, incl. concatenated frames, i.e. `.zst`
+};
+
+/// Detect the compression format of some input by its leading magic bytes
+[[nodiscard]] auto DetectCompression(std::string_view head) -> Compression;
+
+/// Sequential, decompressing reader of a file, FIFO or stdin
+///   - the compression format is detected by the input's magic bytes rather than its extension
+///   - the input is read & decompressed on a dedicated thread into one of two buffers whilst the consumer reads
+///     the other, i.e. reading overlaps with parsing & at most two blocks are held in memory
+///   - blocks aren't aligned to any record boundary; a view handed out by `Next()` is only valid until the
+///     following call to `Next()`
+///
+class InputStream final {
+  /// Number of buffers shared by the reader thread & the consumer
+  static constexpr const size_t kBufferCount{2U};
+
+  /// Size of the compressed input read per syscall
+  static constexpr const size_t kInputSize{1LL << 17};
+
+public:
+  /// Describes the standard input stream
+  static constexpr const char *const kStdinPath{"-"};
+
+  /// Default size of each block handed out by `Next()`
+  static constexpr const size_t kDefaultBlockSize{1LL << 22};
+
+public:
+  /// Open some file, FIFO, or stdin if the path is `kStdinPath`, & begin reading it
+  static auto Open(const char *filepath, size_t blockSize = kDefaultBlockSize)
+    -> nonstd::expected<std::unique_ptr<InputStream>, Result>;
+
+  /// Test whether some path describes an uncompressed regular file, i.e. one that may be memory-mapped instead
+  [[nodiscard]] static auto IsMappable(const char *filepath) -> bool;
+
+  /// Test whether some path describes a file that may be read more than once, i.e. not a FIFO or stdin
+  [[nodiscard]] static auto IsRereadable(const char *filepath) -> bool;
+
+public:
+  ~InputStream();
+
+  InputStream(InputStream const &)                   = delete;
+  auto operator=(InputStream const &)->InputStream & = delete;
+
+  /// Retrieve the next block of (decompressed) input, returning false once the input is exhausted or on err
+  ///   - see `GetResult()` to distinguish the end of the input from an err
+  auto Next(std::string_view &block) -> bool;
+
+  /// Getter: retrieve the `Result` describing success or any err raised whilst reading
+  [[nodiscard]] auto GetResult() -> Result;
+
+  /// Getter: the compression format of the input
+  [[nodiscard]] auto GetCompression() const -> Compression {
+    return compression_;
+  }
+
+private:
+  /// Reader thread: read & decode the input until it's exhausted, an err occurs or the stream is destroyed
+  auto produce() -> void;
+
+  /// Decode uncompressed input, i.e. read it directly into each block
+  auto decodeRaw() -> Result;
+
+  /// Decode gzip input
+  auto decodeGzip() -> Result;
+
+  /// Decode Zstandard input
+  auto decodeZstd() -> Result;
+
+  /// Read some input, first consuming the bytes read to detect its compression; returns zero at the end of input
+  auto readInput(char *out, size_t size) -> nonstd::expected<size_t, Result>;
+
+  /// Acquire the unused region of the reader's current block, waiting for the consumer to release it if needed
+  ///   - returns an empty span if the stream is being destroyed
+  auto acquire() -> std::span<char>;
+
+  /// Commit some bytes written to the region returned by `acquire()`, publishing the block once it's full
+  auto commit(size_t size) -> void;
+
+  /// Publish the reader's current block, if it contains any bytes
+  auto publish() -> void;
+
+private:
+  int         fd_;           /// Input file descriptor
+  bool        owned_;        /// Whether the file descriptor is closed by this instance
+  Compression compression_;  /// Input compression format
+  std::string head_;         /// Leading bytes read to detect the compression format, consumed by `readInput()`
+  size_t      blockSize_;    /// Size of each block
+
+  std::array<std::vector<char>, kBufferCount> buffers_;         /// Block buffers
+  std::array<size_t, kBufferCount>            sizes_{};         /// Size of each published block
+  std::array<bool, kBufferCount>              full_{};          /// Whether each block is published & unreleased
+  size_t                                      write_{0};        /// Index of the reader's current block
+  size_t                                      fill_{0};         /// Number of bytes written to the reader's block
+  size_t                                      read_{0};         /// Index of the consumer's next block
+  size_t                                      held_{0};         /// Index of the block held by the consumer, if any
+  bool                                        holding_{false};  /// Whether the consumer holds a block
+  bool                                        done_{false};     /// Whether the reader has finished
+  bool                                        stop_{false};     /// Whether the stream is being destroyed
+  Result                                      result_;          /// Reader result
+  std::mutex                                  mutex_;           /// Guards the block state & result
+  std::condition_variable                     cond_;            /// Signalled on any change to the block state
+  std::thread                                 worker_;          /// Reader thread
+
+protected:
+  InputStream(int fd, bool owned, Compression compression, std::string head, size_t blockSize);
+};
+
+}  // namespace common
+}  // namespace termspp
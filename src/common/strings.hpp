@@ -1,7 +1,13 @@
 #pragma once
 
+#include "termspp/common/result.hpp"
+
+#include <charconv>
+#include <concepts>
 #include <functional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace termspp {
 namespace common {
@@ -65,23 +71,77 @@ inline auto trim(std::basic_string<CharT, TraitsT, AllocT> &input) -> uint32_t {
   return trimmed;
 }
 
+/// Removes leading & trailing whitespace from a view, i.e. without copying or allocating
+constexpr auto trimView(std::string_view input) -> std::string_view {
+  constexpr auto kWhitespace = std::string_view{" \t\n\f\v\r"};
+
+  const auto first = input.find_first_not_of(kWhitespace);
+  if (first == std::string_view::npos) {
+    return std::string_view{};
+  }
+
+  return input.substr(first, input.find_last_not_of(kWhitespace) - first + 1);
+}
+
+/// Attempt to coerce a `/^\s*(Y|N)\s*$/i` string-like object into a boolean
+///   - never throws or allocates; returns `Status::kEmptyNodeDataErr` if the input is empty or only composed of
+///     whitespace, or `Status::kInvalidDataTypeErr` if it's malformed
+constexpr auto tryCoerceBoolean(std::string_view input, bool &out) -> Status {
+  const auto strv = trimView(input);
+  if (strv.empty()) {
+    return Status::kEmptyNodeDataErr;
+  }
+
+  if (strv.size() != 1) {
+    return Status::kInvalidDataTypeErr;
+  }
+
+  switch (strv.front()) {
+  case 'Y':
+  case 'y':
+    out = true;
+    return Status::kSuccessful;
+  case 'N':
+  case 'n':
+    out = false;
+    return Status::kSuccessful;
+  default:
+    return Status::kInvalidDataTypeErr;
+  }
+}
+
+/// Attempt to parse a base 10 integer from a string-like object, ignoring leading & trailing whitespace
+///   - never throws or allocates; returns `Status::kEmptyNodeDataErr` if the input is empty or only composed of
+///     whitespace, or `Status::kInvalidDataTypeErr` if it's malformed, out of range or has trailing characters
+template <std::integral T>
+inline auto tryParseInteger(std::string_view input, T &out) -> Status {
+  const auto strv = trimView(input);
+  if (strv.empty()) {
+    return Status::kEmptyNodeDataErr;
+  }
+
+  auto       value  = T{};
+  const auto result = std::from_chars(strv.data(), strv.data() + strv.size(), value);
+  if (result.ec != std::errc{} || result.ptr != strv.data() + strv.size()) {
+    return Status::kInvalidDataTypeErr;
+  }
+
+  out = value;
+  return Status::kSuccessful;
+}
+
 /// Coerce a `/^(Y|N)$/i` string-like object into a boolean
+///   - throws `std::runtime_error` if the input is malformed, see `tryCoerceBoolean()` for a non-throwing variant
 template <typename StrLike>
   requires requires(const StrLike &str) { std::basic_string_view{str}; }
 inline auto coerceIntoBoolean(const StrLike &input) -> bool {
   auto strv = std::basic_string_view{input};
-  auto str  = std::string{strv.data(), strv.size()};
-  common::trim(str);
-
-  auto chr = std::toupper(str.front());
-  switch (chr) {
-  case 'Y':
-    return true;
-  case 'N':
-    return false;
-  default:
+  auto out  = false;
+  if (tryCoerceBoolean(std::string_view{strv.data(), strv.size()}, out) != Status::kSuccessful) {
     throw std::runtime_error("failed to coerce boolean");
   }
+
+  return out;
 };
 
 }  // namespace common
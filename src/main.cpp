@@ -11,6 +11,8 @@
 //   - debug targets are defined by the `DBG_MSH_PATH` & `DBG_MAP_PATH`;
 //     these are temporary targets defined by compiler -D opt; will be parsed
 //     from `argv` at some point
+//   - the optional MeSH qualifier & supplementary concept targets are defined
+//     by `DBG_MSH_QUAL_PATH` & `DBG_MSH_SUPP_PATH` respectively; unused if empty
 //
 #ifndef DBG_MSH_PATH
 #define DBG_MSH_PATH
@@ -20,6 +22,14 @@
 #define DBG_MAP_PATH
 #endif
 
+#ifndef DBG_MSH_QUAL_PATH
+#define DBG_MSH_QUAL_PATH
+#endif
+
+#ifndef DBG_MSH_SUPP_PATH
+#define DBG_MSH_SUPP_PATH
+#endif
+
 namespace builder = termspp::builder;
 
 auto main() -> int {
@@ -42,12 +52,20 @@ auto main() -> int {
   //  - buffer docs
   //
 
-  auto msh_target = std::string{MACRO_STRINGIFY(DBG_MSH_PATH)};  // MeSH XML resource target
-  auto map_target = std::string{MACRO_STRINGIFY(DBG_MAP_PATH)};  // SCT-MeSH (csv/rrf) resource target
+  auto msh_target  = std::string{MACRO_STRINGIFY(DBG_MSH_PATH)};       // MeSH XML resource target
+  auto map_target  = std::string{MACRO_STRINGIFY(DBG_MAP_PATH)};       // SCT-MeSH (csv/rrf) resource target
+  auto qual_target = std::string{MACRO_STRINGIFY(DBG_MSH_QUAL_PATH)};  // MeSH qualifier XML resource target
+  auto supp_target = std::string{MACRO_STRINGIFY(DBG_MSH_SUPP_PATH)};  // MeSH supplementary XML resource target
+
+  // Target vocabularies, e.g. `SNOMED!VET,MSH,ICD10CM`; defaults to SNOMED & MeSH if unset
+  const auto *vocabularies = std::getenv("TERMSPP_VOCABULARIES");
 
   auto doc = builder::Document({
-    .sctTarget  = map_target,
-    .meshTarget = msh_target,
+    .sctTarget      = map_target,
+    .meshTarget     = msh_target,
+    .meshQualTarget = qual_target,
+    .meshSuppTarget = supp_target,
+    .vocabularies   = vocabularies != nullptr ? vocabularies : "",
   });
 
   std::printf("[Debug: %8s] Document result: { Code: %2d, Msg: %s }\n",
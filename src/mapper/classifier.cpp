@@ -0,0 +1,151 @@
+#include "termspp/mapper/classifier.hpp"
+#include "termspp/mapper/constants.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace mapper = ::termspp::mapper;
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Vocabulary spec delimiter(s)
+constexpr const char kVocabularyDelimiter = ',';
+constexpr const char kExclusionDelimiter  = '!';
+
+/// Split some string by a delimiter, retaining empty element(s)
+auto splitSpec(std::string_view input, char delimiter) -> std::vector<std::string_view> {
+  auto output = std::vector<std::string_view>{};
+  while (true) {
+    const auto offset = input.find(delimiter);
+    output.emplace_back(input.substr(0, offset));
+    if (offset == std::string_view::npos) {
+      break;
+    }
+
+    input.remove_prefix(offset + 1);
+  }
+
+  return output;
+}
+
+/// Test whether a SAB belongs to some vocabulary
+auto matchesVocabulary(std::string_view sab, const mapper::SourceVocabulary &vocabulary) -> bool {
+  if (!sab.starts_with(vocabulary.prefix)) {
+    return false;
+  }
+
+  return std::none_of(vocabulary.exclusions.begin(), vocabulary.exclusions.end(), [sab](const auto &suffix) {
+    return sab.ends_with(suffix);
+  });
+}
+
+/// Test whether some vocabulary may admit a SAB beginning with `sab`, e.g. `SNOMED!VET` or `SNOMEDCT_US` for
+/// `SNOMED`; exclusions aren't considered
+auto admitsSource(const std::vector<mapper::SourceVocabulary> &vocabularies, std::string_view sab) -> bool {
+  return std::any_of(vocabularies.begin(), vocabularies.end(), [sab](const auto &vocabulary) {
+    return sab.starts_with(vocabulary.prefix) || std::string_view{vocabulary.prefix}.starts_with(sab);
+  });
+}
+
+/************************************************************
+ *                                                          *
+ *                     SourceClassifier                     *
+ *                                                          *
+ ************************************************************/
+
+mapper::SourceClassifier::SourceClassifier() : SourceClassifier(std::vector<SourceVocabulary>{}) {}
+
+mapper::SourceClassifier::SourceClassifier(std::vector<SourceVocabulary> vocabularies)
+    : vocabularies_(std::move(vocabularies)) {
+  // Order ids by leading byte, preferring the longest prefix within each bucket
+  order_.reserve(vocabularies_.size());
+  for (uint32_t id = 0; id < vocabularies_.size(); ++id) {
+    if (!vocabularies_[id].prefix.empty()) {
+      order_.emplace_back(id);
+    }
+  }
+
+  std::stable_sort(order_.begin(), order_.end(), [this](uint32_t lhs, uint32_t rhs) {
+    const auto &lhs_prefix = vocabularies_[lhs].prefix;
+    const auto &rhs_prefix = vocabularies_[rhs].prefix;
+    if (lhs_prefix.front() != rhs_prefix.front()) {
+      return static_cast<uint8_t>(lhs_prefix.front()) < static_cast<uint8_t>(rhs_prefix.front());
+    }
+
+    return lhs_prefix.length() > rhs_prefix.length();
+  });
+
+  // Count each bucket's id(s), then accumulate the counts into offsets
+  for (const auto id : order_) {
+    buckets_[static_cast<uint8_t>(vocabularies_[id].prefix.front()) + 1]++;
+  }
+
+  for (size_t index = 1; index < buckets_.size(); ++index) {
+    buckets_[index] += buckets_[index - 1];
+  }
+}
+
+auto mapper::SourceClassifier::Parse(std::string_view spec) -> nonstd::expected<SourceClassifier, common::Result> {
+  if (spec.empty()) {
+    spec = kDefaultVocabularies;
+  }
+
+  auto vocabularies = std::vector<SourceVocabulary>{};
+  for (const auto entry : splitSpec(spec, kVocabularyDelimiter)) {
+    auto parts = splitSpec(entry, kExclusionDelimiter);
+    if (std::any_of(parts.begin(), parts.end(), [](std::string_view part) { return part.empty(); })) {
+      auto msg = std::string{entry};
+      msg.insert(0, "malformed vocabulary spec @ ");
+
+      return nonstd::make_unexpected(common::Result{common::Status::kInvalidArguments, msg});
+    }
+
+    const auto duplicate = std::any_of(vocabularies.begin(), vocabularies.end(), [&parts](const auto &elem) {
+      return elem.prefix == parts.front();
+    });
+
+    if (duplicate) {
+      auto msg = std::string{parts.front()};
+      msg.insert(0, "duplicate vocabulary @ ");
+
+      return nonstd::make_unexpected(common::Result{common::Status::kInvalidArguments, msg});
+    }
+
+    auto &vocabulary  = vocabularies.emplace_back();
+    vocabulary.prefix = parts.front();
+    vocabulary.exclusions.assign(parts.begin() + 1, parts.end());
+  }
+
+  // A concept is only retained if it xrefs a MeSH & a SNOMED code, i.e. a spec lacking either yields no record(s)
+  for (const auto *sab : {kMeshSab, kSnomedSab}) {
+    if (!admitsSource(vocabularies, sab)) {
+      auto msg = std::string{sab};
+      msg.insert(0, "expected vocabulary spec to include ");
+
+      return nonstd::make_unexpected(common::Result{common::Status::kInvalidArguments, msg});
+    }
+  }
+
+  return SourceClassifier{std::move(vocabularies)};
+}
+
+auto mapper::SourceClassifier::Classify(std::string_view sab) const -> uint32_t {
+  if (sab.empty()) {
+    return kUnclassified;
+  }
+
+  const auto bucket = static_cast<uint8_t>(sab.front());
+  for (auto index = buckets_[bucket]; index < buckets_[bucket + 1]; ++index) {
+    const auto id = order_[index];
+    if (matchesVocabulary(sab, vocabularies_[id])) {
+      return id;
+    }
+  }
+
+  return kUnclassified;
+}
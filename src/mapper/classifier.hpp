@@ -0,0 +1,79 @@
+#pragma once
+
+#include "termspp/common/result.hpp"
+
+#include "nonstd/expected.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace termspp {
+namespace mapper {
+
+/// Describes a target vocabulary, i.e. the SAB(s) beginning with `prefix` that don't end with any of `exclusions`
+///   - e.g. `SNOMED` excluding `VET` matches `SNOMEDCT_US` but not `SNOMEDCT_VET`
+struct SourceVocabulary {
+  std::string              prefix;
+  std::vector<std::string> exclusions;
+};
+
+/// Classifies source abbreviations, i.e. SAB, by the target vocabulary they belong to
+///   - the vocabularies are bucketed by the first byte of their prefix once when constructed, such that each
+///     lookup only compares the prefix(es) sharing the SAB's first byte; a SAB matching more than one vocabulary
+///     is assigned to the one with the longest prefix
+///   - lookups neither allocate nor mutate, i.e. a classifier may be shared across threads
+///   - the vocabularies only decide which row(s) are kept: a concept is only retained if it xrefs a MeSH & a
+///     SNOMED code, i.e. any other vocabulary, e.g. `ICD10CM`, is carried alongside that pairing but never forms
+///     an xref by itself; see `SctDocument::hasSibling()`
+///
+class SourceClassifier final {
+  /// Number of buckets, i.e. one per leading byte
+  static constexpr const size_t kBuckets{256U};
+
+public:
+  /// Describes a SAB that doesn't belong to any of the classifier's vocabularies
+  static constexpr const uint32_t kUnclassified{std::numeric_limits<uint32_t>::max()};
+
+  /// Vocabulary spec describing the SNOMED & MeSH sources, see `Parse()`
+  static constexpr const char *const kDefaultVocabularies{"SNOMED!VET,MSH"};
+
+public:
+  /// Construct a classifier that classifies nothing
+  SourceClassifier();
+
+  /// Construct a classifier from a set of vocabularies; each vocabulary's id is its index within the set
+  explicit SourceClassifier(std::vector<SourceVocabulary> vocabularies);
+
+  /// Parse a classifier from its spec
+  ///   - a spec is a comma-separated list of vocabularies, each described by its prefix & optionally followed by
+  ///     one or more `!`-separated suffix(es) it excludes, e.g. `SNOMED!VET,MSH,ICD10CM,RXNORM,LNC`
+  ///   - an empty spec describes `kDefaultVocabularies`
+  ///   - a spec that doesn't include the MeSH & SNOMED sources is rejected, since it can't describe any xref
+  [[nodiscard]] static auto Parse(std::string_view spec) -> nonstd::expected<SourceClassifier, common::Result>;
+
+  /// Find the id of the vocabulary the given SAB belongs to, returning `kUnclassified` if it doesn't belong to any
+  [[nodiscard]] auto Classify(std::string_view sab) const -> uint32_t;
+
+  /// Getter: the vocabulary assoc. with some id, expected to be less than `Size()`
+  [[nodiscard]] auto Get(uint32_t id) const -> const SourceVocabulary & {
+    return vocabularies_[id];
+  }
+
+  /// Getter: the number of vocabularies described by this classifier
+  [[nodiscard]] auto Size() const -> size_t {
+    return vocabularies_.size();
+  }
+
+private:
+  std::vector<SourceVocabulary>      vocabularies_;  /// Vocabularies, indexed by id
+  std::vector<uint32_t>              order_;         /// Vocabulary ids ordered by leading byte, longest prefix first
+  std::array<uint32_t, kBuckets + 1> buckets_{};     /// Offset of each leading byte's id(s) within `order_`
+};
+
+}  // namespace mapper
+}  // namespace termspp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace termspp {
 namespace mapper {
@@ -14,9 +15,21 @@ constexpr const size_t kConsoSourceColIndex   = 11U;  /// Concept source abbrevi
 constexpr const size_t kConsoTargetColIndex   = 13U;  /// Concept target code/term
 constexpr const size_t kConsoSuppressColIndex = 16U;  /// Concept suppression status
 
+/// Max. number of columns contained by a row, RRF tables describe at most 18
+constexpr const size_t kMaxRowColumns = 32U;
+
+/// Max. number of rows handed to a batched `FilterPolicy` at once, see `RowBatchFilter`
+constexpr const size_t kFilterBatchSize = 32U;
+
+/// Concept unique identifier format, i.e. `C` followed by seven digits
+constexpr const size_t kCuiLength = 8U;
+constexpr const char   kCuiPrefix = 'C';
+
+/// Max. number of distinct source abbreviations, i.e. the range of `SctRecord::src`
+constexpr const uint32_t kMaxSourceId = 0xFFFFU;
+
 /// Mem. alignment
-constexpr const size_t kSctRowAlignment    = 32U;
-constexpr const size_t kSctRecordAlignment = 16U;
+constexpr const size_t kSctRowAlignment = 32U;
 
 /// Source abbreviation name(s)
 constexpr const char *const kMeshSab   = "MSH";
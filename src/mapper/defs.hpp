@@ -2,25 +2,80 @@
 
 #include "termspp/common/result.hpp"
 #include "termspp/mapper/constants.hpp"
+#include "termspp/mapper/pool.hpp"
+#include "termspp/mapper/tokenizer.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
-#include <map>
-#include <memory>
 #include <ostream>
-#include <string>
+#include <span>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace termspp {
 namespace mapper {
 
+class RecordIndex;
+
+/// Sct document load strategies
+enum class SctLoadMode : uint8_t {
+  kBatch,      // Buffer every candidate record before grouping them by CUI, i.e. rows may be in any order
+  kStreaming,  // Group records by CUI as they're parsed, bounding memory by the largest concept; expects sorted rows
+};
+
 /************************************************************
  *                                                          *
  *                         Records                          *
  *                                                          *
  ************************************************************/
 
-/// Columns contained by a single row
-typedef std::vector<std::string_view> SctCols;
+/// Fixed-capacity view of the columns contained by a single row
+///   - each column views the source row, i.e. constructing & copying a row never allocates
+///   - rows of more than `kMaxRowColumns` columns are truncated by `Push()`
+class SctCols final {
+public:
+  /// Append a column, returning false if the row is full
+  auto Push(std::string_view column) -> bool {
+    if (size_ == data_.size()) {
+      return false;
+    }
+
+    data_[size_++] = column;
+    return true;
+  }
+
+  /// Getter: the number of columns contained by this row
+  [[nodiscard]] auto Size() const -> size_t {
+    return size_;
+  }
+
+  /// Getter: whether this row is empty
+  [[nodiscard]] auto Empty() const -> bool {
+    return size_ == 0;
+  }
+
+  /// Getter: the column at the given index, expected to be less than `Size()`
+  [[nodiscard]] auto operator[](size_t index) const -> std::string_view {
+    return data_[index];
+  }
+
+  /// Iterate across each column
+  [[nodiscard]] auto begin() const {
+    return data_.begin();
+  }
+
+  [[nodiscard]] auto end() const {
+    return data_.begin() + static_cast<ptrdiff_t>(size_);
+  }
+
+private:
+  std::array<std::string_view, kMaxRowColumns> data_;
+  size_t                                       size_{0};
+};
 
 /// Describes a parsed map row
 ///   - Used for structured binding of ColumnDelimiter policy
@@ -31,97 +86,64 @@ struct alignas(kSctRowAlignment) SctRow {
 };
 
 /// Describes a finalised map record
-struct alignas(kSctRecordAlignment) SctRecord {
-  char *uidBuf;
-  char *srcBuf;
-  char *trgBuf;
-
-  friend auto operator<<(std::ostream &stream, const SctRecord &obj)->std::ostream & {
-    return stream << obj.uidBuf << "|"    //
-                  << obj.srcBuf << "|"    //
-                  << obj.trgBuf << "\n";  //
-  }
+///   - a 12 byte POD: CUIs are encoded by `EncodeCui()` & the SAB/CODE components are ids interned by the
+///     document's `SctStrings`, see `SctEntry` to resolve them
+struct SctRecord {
+  uint32_t uid;  // Encoded CUI
+  uint32_t trg;  // Id of the code/term within `SctStrings::codes`
+  uint16_t src;  // Id of the source abbreviation within `SctStrings::sources`
+
+  auto operator==(const SctRecord &other) const -> bool = default;
 };
 
-/// Uid reference map type
-typedef std::tuple<std::string_view, std::string_view, std::string_view> SctKey;
-
-/// Lookup by individual key components
-struct RecordLookup {
-  std::string_view uid;
-  std::string_view src;
-  std::string_view trg;
-};
-
-/// Comparator for record keys
-struct RecordComp {
-  using is_transparent = bool;
-
-  auto operator()(SctKey const &elem0, SctKey const &elem1) const->bool {
-    auto comp0 = std::string(std::get<0>(elem0));
-    auto comp1 = std::string(std::get<0>(elem1));
+static_assert(sizeof(SctRecord) == 12 && std::is_trivially_copyable_v<SctRecord>, "expected a compact POD");
 
-    comp0 += std::get<1>(elem0);
-    comp1 += std::get<1>(elem1);
+/// Describes a record resolved against the string pool(s) of its document, e.g. for writing
+struct SctEntry {
+  std::array<char, kCuiLength> uid;
+  std::string_view             src;
+  std::string_view             trg;
 
-    return comp0.compare(comp1) < 0;
+  friend auto operator<<(std::ostream &stream, const SctEntry &obj)->std::ostream & {
+    return stream << std::string_view{obj.uid.data(), obj.uid.size()} << "|"  //
+                  << obj.src << "|"                                           //
+                  << obj.trg << "\n";                                         //
   }
+};
 
-  auto operator()(SctKey const &elem, const RecordLookup &lkup) const->bool {
-    auto comp0 = std::string{};
-    auto comp1 = std::string{};
-
-    if (!lkup.uid.empty()) {
-      comp0 += std::get<0>(elem);
-      comp1 += lkup.uid;
-    }
-
-    if (!lkup.src.empty()) {
-      comp0 += std::get<1>(elem);
-      comp1 += lkup.src;
-    }
-
-    if (!lkup.trg.empty()) {
-      comp0 += std::get<2>(elem);
-      comp1 += lkup.trg;
-    }
+/// Records, ordered by CUI then SAB once parsed
+typedef std::vector<SctRecord> RecordSct;
 
-    return comp0.compare(comp1) < 0;
+/// Encode a CUI, i.e. `C` followed by seven digits, as an integer; returns false if malformed
+constexpr auto EncodeCui(std::string_view cui, uint32_t &out) -> bool {
+  if (cui.size() != kCuiLength || cui.front() != kCuiPrefix) {
+    return false;
   }
 
-  auto operator()(const RecordLookup &lkup, SctKey const &elem) const->bool {
-    auto comp0 = std::string{};
-    auto comp1 = std::string{};
-
-    if (!lkup.uid.empty()) {
-      comp0 += std::get<0>(elem);
-      comp1 += lkup.uid;
+  uint32_t value{0};
+  for (const auto chr : cui.substr(1)) {
+    if (chr < '0' || chr > '9') {
+      return false;
     }
 
-    if (!lkup.src.empty()) {
-      comp0 += std::get<1>(elem);
-      comp1 += lkup.src;
-    }
-
-    if (!lkup.trg.empty()) {
-      comp0 += std::get<2>(elem);
-      comp1 += lkup.trg;
-    }
-
-    return comp1.compare(comp0) < 0;
+    value = value * 10 + static_cast<uint32_t>(chr - '0');
   }
 
-  auto operator()(SctKey const &elem, const std::string_view &lkup) const->bool {
-    return std::get<0>(elem).compare(lkup) < 0;
-  }
+  out = value;
+  return true;
+}
 
-  auto operator()(const std::string_view &lkup, SctKey const &elem) const->bool {
-    return lkup.compare(std::get<0>(elem)) < 0;
+/// Decode a CUI encoded by `EncodeCui()`
+constexpr auto DecodeCui(uint32_t uid) -> std::array<char, kCuiLength> {
+  auto out = std::array<char, kCuiLength>{};
+  out[0]   = kCuiPrefix;
+  for (size_t index = kCuiLength - 1; index > 0; --index) {
+    out[index]  = static_cast<char>('0' + (uid % 10));
+    uid        /= 10;
   }
-};
 
-/// Multimap of records, keyed to components
-typedef std::multimap<SctKey, SctRecord, RecordComp> RecordSct;
+  return out;
+}
 
 /************************************************************
  *                                                          *
@@ -132,32 +154,54 @@ typedef std::multimap<SctKey, SctRecord, RecordComp> RecordSct;
 /// Predicate type for `FilterPolicy` policies
 typedef bool (*SctPredicate)(SctRow &);
 
-/// Record handler for `BuilderPolicy` policies
-typedef bool (*RowBuilder)(const SctCols &, uint8_t *, SctRecord &);
+/// Batch predicate type for `FilterPolicy` policies, flagging each row of a block that's to be filtered
+typedef void (*SctBatchPredicate)(std::span<SctRow>, std::span<bool>);
 
-/// Record handler for `SctPolicy` policies
-typedef bool (*SctTester)(const SctRow &, const RecordSct &);
+/// Record handler for `BuilderPolicy` policies, interning the record's component(s) into the given pool(s)
+typedef bool (*RowBuilder)(const SctCols &, SctStrings &, SctRecord &);
+
+/// Record handler for `SctPolicy` policies, tested against the records parsed so far
+typedef bool (*SctTester)(const SctRecord &, const RecordIndex &);
 
 /************************************************************
  *                                                          *
- *                         Helpers                          *
+ *                        Projection                        *
  *                                                          *
  ************************************************************/
-/// Filter columns by index
-template <typename Container, typename Iter>
-auto FilterColumnIndices(Container &container, uint64_t &size, Iter beg, Iter end) -> decltype(std::end(container)) {
-  size_t index{0};
-  size = 0;
-
-  return std::stable_partition(
-    std::begin(container), std::end(container), [&](typename Container::value_type const &val) -> bool {
-      if (std::find(beg, end, index++) == end) {
-        return false;
-      };
-
-      size += val.length() + 1;
-      return true;
-    });
+
+/// Describes the column(s) of a row that are consumed by a document's policies
+///   - delimiter policies stop tokenising after the last column of the set & only materialise the column(s)
+///     contained by it; any other column preceding the last is left empty such that indices are retained
+///
+/// Example:
+/// ```cpp
+///   // Tokenises columns [0, 3], materialising columns 0 & 3 only
+///   typedef ColumnProjection<0, 3> SomeColumns;
+/// ```
+///
+template <size_t... Indices>
+struct ColumnProjection {
+  static_assert(sizeof...(Indices) > 0 && ((Indices < kMaxRowColumns) && ...), "expected column(s) within a row");
+
+  /// Number of column(s) tokenised per row, i.e. the last projected column + 1
+  static constexpr const size_t kWidth = std::max({Indices...}) + 1;
+
+  /// Bitmask of the projected column(s)
+  static constexpr const uint64_t kMask = ((uint64_t{1} << Indices) | ...);
+
+  /// Test whether the column at some index is projected
+  static constexpr auto Contains(size_t index) -> bool {
+    return ((kMask >> index) & 1U) != 0;
+  }
+};
+
+/// Projection of every column of a row
+struct AllColumns {
+  static constexpr const size_t kWidth = kMaxRowColumns;
+
+  static constexpr auto Contains(size_t /*index*/) -> bool {
+    return true;
+  }
 };
 
 /************************************************************
@@ -167,51 +211,72 @@ auto FilterColumnIndices(Container &container, uint64_t &size, Iter beg, Iter en
  ************************************************************/
 
 /// DelimiterPolicy: Parse columns from a row by some delimiter described by `Token`
-template <char Token = '|'>
+///   - the row is never read beyond `input.size()`, i.e. it needn't be null-terminated
+///   - only columns closed by a delimiter are emitted; each column views `input`
+///   - parsing stops after the last column described by `Projection`, see `ColumnProjection`
+template <char Token = '|', class Projection = AllColumns>
 struct ColumnDelimiter {
   static auto ParseLine(std::string_view input) -> SctRow {
-    auto data = SctCols{};
-    data.reserve(input.length() / 2);
-
-    uint64_t size{0};
-    size_t   length{0};
+    auto row = SctRow{.cols = {}, .size = 0, .status = common::Status::kSuccessful};
 
     const auto *ptr = input.data();
-    const auto dlm  = std::unique_ptr<const char[]>(new char[1]{Token});
-    while (ptr) {
+    const auto *end = input.data() + input.size();
+    while (ptr != nullptr && ptr < end && *ptr != '\n' && row.cols.Size() < Projection::kWidth) {
       const auto *src = ptr;
-      const auto chr  = *src;
-      switch (chr) {
-      case '\n':
-        goto exit;
+
+      ptr = static_cast<const char *>(std::memchr(src, Token, static_cast<size_t>(end - src)));
+      if (ptr == nullptr) {
         break;
-      default: {
-        ptr = std::strpbrk(ptr, dlm.get());
-        if (ptr != nullptr) {
-          length  = static_cast<size_t>(ptr - src);
-          size   += length + 1;
-
-          data.emplace_back(src, length);
-          ptr++;
-          break;
-        }
-
-        goto exit;
       }
-      };
+
+      if (Projection::Contains(row.cols.Size())) {
+        row.size += static_cast<size_t>(ptr - src) + 1;
+        row.cols.Push(std::string_view{src, static_cast<size_t>(ptr - src)});
+      } else {
+        row.cols.Push(std::string_view{});
+      }
+
+      ptr++;
     }
 
-  exit:
-    auto status = common::Status::kSuccessful;
-    if (size < 1 || data.size() < 1) {
-      status = common::Status::kNoRowData;
+    if (row.size < 1 || row.cols.Empty()) {
+      row.status = common::Status::kNoRowData;
     }
 
-    return {
-      .cols   = std::move(data),
-      .size   = size,
-      .status = status,
-    };
+    return row;
+  }
+};
+
+/// DelimiterPolicy: Vectorised variant of `ColumnDelimiter`, see `FindColumns()`
+///   - delimiters are found 64 bytes at a time into a fixed-size offset array, i.e. using the widest
+///     instruction set supported by the host
+///   - tokenising stops after the last column described by `Projection`, see `ColumnProjection`
+template <char Token = '|', class Projection = AllColumns>
+struct VectorDelimiter {
+  static auto ParseLine(std::string_view input) -> SctRow {
+    auto row = SctRow{.cols = {}, .size = 0, .status = common::Status::kSuccessful};
+
+    std::array<uint32_t, Projection::kWidth> ends;
+
+    const auto count = FindColumns(input, Token, ends);
+
+    uint32_t begin{0};
+    for (size_t index = 0; index < count; ++index) {
+      if (Projection::Contains(index)) {
+        row.size += ends[index] - begin + 1;
+        row.cols.Push(std::string_view{input.data() + begin, ends[index] - begin});
+      } else {
+        row.cols.Push(std::string_view{});
+      }
+
+      begin = ends[index] + 1;
+    }
+
+    if (row.size < 1 || row.cols.Empty()) {
+      row.status = common::Status::kNoRowData;
+    }
+
+    return row;
   }
 };
 
@@ -230,14 +295,23 @@ struct RowFilter {
   }
 };
 
-/// FilterPolicy: Filter rows by some predicate with capture
-template <class L>
-auto LambdaFilter(L &&lambda) {
-  static L func = std::forward<L>(lambda);
-  return [](SctRow &row) -> bool {
-    return func(row);
-  };
-}
+/// FilterPolicy: Filter blocks of up to `kFilterBatchSize` rows by some batch predicate
+///   - rows are parsed ahead of the filter & handed to it together, e.g. such that the lookups of a block can be
+///     prefetched & resolved together; see `BatchFilterPolicy`
+template <SctBatchPredicate Predicate>
+struct RowBatchFilter {
+  static auto FilterBatch(std::span<SctRow> rows, std::span<bool> filtered) -> void {
+    Predicate(rows, filtered);
+  }
+};
+
+/// Describes a `FilterPolicy` that filters blocks of rows rather than a single row, see `RowBatchFilter`
+///   - the policy is called through the instance owned by its `SctDocument`, i.e. it may be stateful, in which
+///     case `FilterBatch()` is expected to be const & safe to call from multiple threads
+template <class Policy>
+concept BatchFilterPolicy = requires(const Policy &policy, std::span<SctRow> rows, std::span<bool> filtered) {
+  policy.FilterBatch(rows, filtered);
+};
 
 /// SelectorPolicy: Return
 struct AllSelected {
@@ -245,32 +319,43 @@ struct AllSelected {
 };
 
 /// SelectorPolicy: Select columns by indices
+///   - the selected columns are packed in order of declaration; any index beyond the row is ignored
 template <uint16_t... Args>
 struct ColumnSelect {
   static auto Select(SctRow &row) -> void {
-    static const std::vector<uint16_t> kSelected{Args...};
-    row.cols.erase(FilterColumnIndices(row.cols, row.size, kSelected.begin(), kSelected.end()), row.cols.end());
+    static constexpr const std::array<uint16_t, sizeof...(Args)> kSelected{Args...};
+
+    auto cols = SctCols{};
+    row.size  = 0;
+    for (const auto index : kSelected) {
+      if (index < row.cols.Size()) {
+        row.size += row.cols[index].length() + 1;
+        cols.Push(row.cols[index]);
+      }
+    }
+
+    row.cols = cols;
   }
 };
 
-/// SctPolicy: map all rows regardless
+/// SctPolicy: map all records regardless
 struct SctAll {
-  static auto ShouldSct(const SctRow & /*row*/, const RecordSct & /*map*/) -> bool {
+  static auto ShouldSct(const SctRecord & /*record*/, const RecordIndex & /*index*/) -> bool {
     return true;
   }
 };
 
-/// SctPolicy: lambda to test uniqueness/some other prop after selection against existing records
+/// SctPolicy: lambda to test uniqueness/some other prop of a built record against existing records
 template <SctTester Test>
 struct SctSelector {
-  static auto ShouldSct(const SctRow &row, const RecordSct &map) -> bool {
-    return Test(row, map);
+  static auto ShouldSct(const SctRecord &record, const RecordIndex &index) -> bool {
+    return Test(record, index);
   }
 };
 
 /// BuilderPolicy: Default, throw err
 struct NoBuilder {
-  static auto Build(const SctCols & /*cols*/, uint8_t * /*ptr*/, SctRecord & /*record*/) -> bool {
+  static auto Build(const SctCols & /*cols*/, SctStrings & /*strings*/, SctRecord & /*record*/) -> bool {
     return false;
   }
 };
@@ -278,8 +363,8 @@ struct NoBuilder {
 /// BuilderPolicy: Build Conso record
 template <RowBuilder Builder>
 struct RecordBuilder {
-  static auto Build(const SctCols &cols, uint8_t *ptr, SctRecord &record) -> bool {
-    return Builder(cols, ptr, record);
+  static auto Build(const SctCols &cols, SctStrings &strings, SctRecord &record) -> bool {
+    return Builder(cols, strings, record);
   }
 };
 
@@ -0,0 +1,119 @@
+#include "termspp/mapper/index.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace mapper = ::termspp::mapper;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Finalise a 64-bit hash, i.e. the MurmurHash3 `fmix64` avalanche step
+constexpr auto mixHash(uint64_t hash) -> uint64_t {
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33;
+  hash *= 0xC4CEB9FE1A85EC53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/************************************************************
+ *                                                          *
+ *                       RecordIndex                        *
+ *                                                          *
+ ************************************************************/
+
+auto mapper::RecordIndex::Hash(const mapper::RecordIndex::Key &key) -> uint64_t {
+  const auto lhs  = (static_cast<uint64_t>(key.uid) << 32) | key.trg;
+  const auto hash = mixHash(lhs ^ mixHash(static_cast<uint64_t>(key.src) + 0x9E3779B97F4A7C15ULL));
+  return hash != kEmptySlot ? hash : 1U;
+}
+
+auto mapper::RecordIndex::Contains(const mapper::RecordIndex::Key &key) const -> bool {
+  if (size_ == 0) {
+    return false;
+  }
+
+  return hashes_[findSlot(key, Hash(key))] != kEmptySlot;
+}
+
+auto mapper::RecordIndex::Insert(const mapper::RecordIndex::Key &key) -> bool {
+  // Maintain a load factor of at most 1/2
+  if ((size_ + 1) * 2 > hashes_.size()) {
+    rehash(std::max(kMinSlots, hashes_.size() * 2));
+  }
+
+  const auto hash = Hash(key);
+  const auto slot = findSlot(key, hash);
+  if (hashes_[slot] != kEmptySlot) {
+    return false;
+  }
+
+  hashes_[slot] = hash;
+  keys_[slot]   = key;
+  size_++;
+  return true;
+}
+
+auto mapper::RecordIndex::Reserve(size_t count) -> void {
+  const auto slots = std::bit_ceil(std::max(kMinSlots, count * 2));
+  if (slots > hashes_.size()) {
+    rehash(slots);
+  }
+}
+
+auto mapper::RecordIndex::Clear() -> void {
+  if (hashes_.size() == kMinSlots) {
+    if (size_ > 0) {
+      std::fill(hashes_.begin(), hashes_.end(), kEmptySlot);
+    }
+  } else {
+    hashes_.clear();
+    keys_.clear();
+  }
+
+  size_ = 0;
+}
+
+auto mapper::RecordIndex::findSlot(const mapper::RecordIndex::Key &key, uint64_t hash) const -> size_t {
+  const auto mask = hashes_.size() - 1;
+
+  auto position = static_cast<size_t>(hash) & mask;
+  while (hashes_[position] != kEmptySlot) {
+    if (hashes_[position] == hash && keys_[position] == key) {
+      break;
+    }
+
+    position = (position + 1) & mask;
+  }
+
+  return position;
+}
+
+auto mapper::RecordIndex::rehash(size_t slots) -> void {
+  auto hashes = std::vector<uint64_t>(slots, kEmptySlot);
+  auto keys   = std::vector<Key>(slots);
+
+  const auto mask = slots - 1;
+  for (size_t index = 0; index < hashes_.size(); ++index) {
+    if (hashes_[index] == kEmptySlot) {
+      continue;
+    }
+
+    auto position = static_cast<size_t>(hashes_[index]) & mask;
+    while (hashes[position] != kEmptySlot) {
+      position = (position + 1) & mask;
+    }
+
+    hashes[position] = hashes_[index];
+    keys[position]   = keys_[index];
+  }
+
+  hashes_ = std::move(hashes);
+  keys_   = std::move(keys);
+}
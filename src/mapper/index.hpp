@@ -0,0 +1,67 @@
+#pragma once
+
+#include "termspp/mapper/defs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace termspp {
+namespace mapper {
+
+/// Hash set of record keys, i.e. a (CUI, SAB, CODE) triple, used to deduplicate rows whilst parsing
+///   - open-addressed with linear probing; each key's 64-bit hash is computed once & stored alongside the key,
+///     such that probes only verify the full key on a hash match & growing the table never rehashes
+///   - neither probes nor inserts allocate, except when the table grows
+///   - keys are `SctRecord`s, i.e. interned components are expected to share the same `SctStrings`
+///
+class RecordIndex final {
+  /// Min. number of slots allocated by the table
+  static constexpr const size_t kMinSlots{64U};
+
+  /// Slot hash describing an empty slot; key hashes are never zero
+  static constexpr const uint64_t kEmptySlot{0U};
+
+public:
+  /// Describes a record key
+  typedef SctRecord Key;
+
+public:
+  RecordIndex() = default;
+
+  /// Hash a record key
+  [[nodiscard]] static auto Hash(const Key &key) -> uint64_t;
+
+  /// Getter: the number of keys contained by this index
+  [[nodiscard]] auto Size() const -> size_t {
+    return size_;
+  }
+
+  /// Test whether this index contains the given key
+  [[nodiscard]] auto Contains(const Key &key) const -> bool;
+
+  /// Insert a key, returning false if it already exists
+  auto Insert(const Key &key) -> bool;
+
+  /// Reserve capacity for at least `count` keys
+  auto Reserve(size_t count) -> void;
+
+  /// Remove every key from this index
+  ///   - a table of `kMinSlots` is retained, i.e. repeatedly clearing an index of a few keys never allocates
+  auto Clear() -> void;
+
+private:
+  /// Find the slot containing the given key, or the empty slot it would be inserted into
+  [[nodiscard]] auto findSlot(const Key &key, uint64_t hash) const -> size_t;
+
+  /// Reallocate the table to some number of slots, reinserting each key by its stored hash
+  auto rehash(size_t slots) -> void;
+
+private:
+  std::vector<uint64_t> hashes_;   /// Slot hashes, `kEmptySlot` if the slot is empty
+  std::vector<Key>      keys_;     /// Slot keys
+  size_t                size_{0};  /// Number of occupied slots
+};
+
+}  // namespace mapper
+}  // namespace termspp
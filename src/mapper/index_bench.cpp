@@ -0,0 +1,182 @@
+#include "termspp/mapper/index.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace mapper = ::termspp::mapper;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Bench defaults, i.e. the rows & distinct keys of the synthetic 1M-row MRCONSO
+constexpr const size_t kDefaultRows = 1000000U;
+constexpr const size_t kDefaultKeys = 333000U;
+
+/// Number of distinct source abbreviations
+constexpr const uint16_t kBenchSources = 24U;
+
+/// Record key as viewed by the string-keyed set, i.e. the (CUI, SAB, CODE) triple
+typedef std::tuple<std::string_view, std::string_view, std::string_view> SctKey;
+
+/// Comparator of the string-keyed set prior to `RecordIndex`, concatenating each component before comparing
+struct ConcatComp {
+  auto operator()(const SctKey &lhs, const SctKey &rhs) const -> bool {
+    auto comp0 = std::string{std::get<0>(lhs)};
+    auto comp1 = std::string{std::get<0>(rhs)};
+
+    comp0 += std::get<1>(lhs);
+    comp0 += std::get<2>(lhs);
+    comp1 += std::get<1>(rhs);
+    comp1 += std::get<2>(rhs);
+
+    return comp0.compare(comp1) < 0;
+  }
+};
+
+/// Comparator of the string-keyed set prior to `RecordIndex`, comparing each component in turn without allocating
+struct RecordComp {
+  auto operator()(const SctKey &lhs, const SctKey &rhs) const -> bool {
+    if (const auto cmp = std::get<0>(lhs).compare(std::get<0>(rhs)); cmp != 0) {
+      return cmp < 0;
+    }
+
+    if (const auto cmp = std::get<1>(lhs).compare(std::get<1>(rhs)); cmp != 0) {
+      return cmp < 0;
+    }
+
+    return std::get<2>(lhs).compare(std::get<2>(rhs)) < 0;
+  }
+};
+
+/// Describes a row, both by its component text & by its interned id(s)
+struct BenchRow {
+  SctKey            text;
+  mapper::SctRecord record;
+};
+
+/// Time some func, returning the elapsed milliseconds
+template <typename Func>
+auto timeMs(Func &&func) -> double {
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// Deduplicate & then probe every row by some set, printing its throughput
+///   - returns the number of unique rows, such that each set can be verified against the others
+template <typename Insert, typename Contains>
+auto benchSet(const char *name, const std::vector<BenchRow> &rows, Insert &&insert, Contains &&contains) -> size_t {
+  size_t unique{0};
+  size_t found{0};
+
+  const auto insert_ms = timeMs([&] {
+    for (const auto &row : rows) {
+      unique += insert(row) ? 1 : 0;
+    }
+  });
+
+  const auto probe_ms = timeMs([&] {
+    for (const auto &row : rows) {
+      found += contains(row) ? 1 : 0;
+    }
+  });
+
+  std::printf("%-22s %12.0f %12.0f\n", name, rows.size() / insert_ms * 1e3, rows.size() / probe_ms * 1e3);
+  return found == rows.size() ? unique : 0;
+}
+
+/************************************************************
+ *                                                          *
+ *                           Main                           *
+ *                                                          *
+ ************************************************************/
+
+/// Compare the insert & probe throughput of `RecordIndex` against the string-keyed `std::set` it replaced
+///   - usage: `index_bench [rows] [keys]`; rows are drawn from `keys` distinct keys, i.e. most are duplicates
+auto main(int argc, char **argv) -> int {
+  const auto row_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultRows;
+  const auto key_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : kDefaultKeys;
+
+  // Build the key text, i.e. MRCONSO-like CUI(s), SAB(s) & CODE(s)
+  auto rng     = std::mt19937_64{42};
+  auto sources = std::vector<std::string>{};
+  for (uint16_t id = 0; id < kBenchSources; ++id) {
+    sources.emplace_back(id % 2 == 0 ? "SNOMEDCT_US" : "MSH");
+    sources.back().append(std::to_string(id));
+  }
+
+  auto cuis  = std::vector<std::string>(key_count);
+  auto codes = std::vector<std::string>(key_count);
+  auto keys  = std::vector<mapper::SctRecord>(key_count);
+  for (size_t index = 0; index < key_count; ++index) {
+    const auto uid = static_cast<uint32_t>(index / 3);
+
+    auto digits = std::to_string(uid);
+    cuis[index] = "C" + std::string(digits.length() < 7 ? 7 - digits.length() : 0, '0') + digits;
+
+    codes[index] = std::to_string(rng() % 1000000000U);
+    keys[index]  = mapper::SctRecord{uid, static_cast<uint32_t>(index), static_cast<uint16_t>(rng() % kBenchSources)};
+  }
+
+  auto rows = std::vector<BenchRow>{};
+  rows.reserve(row_count);
+  for (size_t index = 0; index < row_count; ++index) {
+    const auto  key    = index < key_count ? index : rng() % key_count;
+    const auto &record = keys[key];
+    rows.emplace_back(BenchRow{SctKey{cuis[key], sources[record.src], codes[key]}, record});
+  }
+
+  std::printf("rows %zu, keys %zu\n", static_cast<size_t>(row_count), static_cast<size_t>(key_count));
+  std::printf("%-22s %12s %12s\n", "", "inserts/s", "probes/s");
+
+  auto concat        = std::set<SctKey, ConcatComp>{};
+  auto concat_unique = benchSet(
+    "std::set, ConcatComp",
+    rows,
+    [&concat](const BenchRow &row) {
+      return concat.insert(row.text).second;
+    },
+    [&concat](const BenchRow &row) {
+      return concat.contains(row.text);
+    });
+
+  auto tree        = std::set<SctKey, RecordComp>{};
+  auto tree_unique = benchSet(
+    "std::set, RecordComp",
+    rows,
+    [&tree](const BenchRow &row) {
+      return tree.insert(row.text).second;
+    },
+    [&tree](const BenchRow &row) {
+      return tree.contains(row.text);
+    });
+
+  auto index        = mapper::RecordIndex{};
+  auto index_unique = benchSet(
+    "RecordIndex",
+    rows,
+    [&index](const BenchRow &row) {
+      return index.Insert(row.record);
+    },
+    [&index](const BenchRow &row) {
+      return index.Contains(row.record);
+    });
+
+  if (concat_unique != key_count || tree_unique != key_count || index_unique != key_count) {
+    std::fprintf(stderr, "expected each set to hold every distinct key\n");
+    return 1;
+  }
+
+  return 0;
+}
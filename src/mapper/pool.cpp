@@ -0,0 +1,45 @@
+#include "termspp/mapper/pool.hpp"
+
+#include <cstring>
+
+namespace mapper = ::termspp::mapper;
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                        StringPool                        *
+ *                                                          *
+ ************************************************************/
+
+mapper::StringPool::StringPool() : arena_(common::Arena::Create(kArenaRegionSize)) {}
+
+auto mapper::StringPool::Intern(std::string_view value) -> uint32_t {
+  const auto existing = index_.Find(value);
+  if (!existing.empty()) {
+    return existing.front();
+  }
+
+  if (strings_.size() >= kInvalidId) {
+    return kInvalidId;
+  }
+
+  uint8_t *ptr{nullptr};
+  if (!value.empty() && !arena_->Allocate(static_cast<int64_t>(value.size()), &ptr)) {
+    return kInvalidId;
+  }
+
+  if (!value.empty()) {
+    std::memcpy(ptr, value.data(), value.size());
+  }
+
+  const auto id   = static_cast<uint32_t>(strings_.size());
+  const auto view = std::string_view{reinterpret_cast<const char *>(ptr), value.size()};
+  strings_.emplace_back(view);
+  index_.Insert(view, id);
+  return id;
+}
+
+auto mapper::StringPool::Find(std::string_view value) const -> uint32_t {
+  const auto existing = index_.Find(value);
+  return existing.empty() ? kInvalidId : existing.front();
+}
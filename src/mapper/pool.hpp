@@ -0,0 +1,61 @@
+#pragma once
+
+#include "termspp/common/arena.hpp"
+#include "termspp/common/flatmap.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace termspp {
+namespace mapper {
+
+/// Interned string pool
+///   - each distinct string is copied into the pool's arena once & assigned a dense id in order of insertion,
+///     i.e. ids are stable & may be used to index other containers
+///   - views returned by `Get()` are valid for the lifetime of the pool
+///
+class StringPool final {
+  /// Arena allocator region size
+  static constexpr const size_t kArenaRegionSize{1LL << 20};
+
+public:
+  /// Describes a string that isn't contained by the pool, or couldn't be interned
+  static constexpr const uint32_t kInvalidId{std::numeric_limits<uint32_t>::max()};
+
+public:
+  StringPool();
+
+  /// Intern a string, returning its id or `kInvalidId` if it couldn't be allocated
+  auto Intern(std::string_view value) -> uint32_t;
+
+  /// Find the id of some string, returning `kInvalidId` if it isn't contained by the pool
+  [[nodiscard]] auto Find(std::string_view value) const -> uint32_t;
+
+  /// Getter: the string assoc. with some id, expected to be less than `Size()`
+  [[nodiscard]] auto Get(uint32_t id) const -> std::string_view {
+    return strings_[id];
+  }
+
+  /// Getter: the number of distinct strings contained by the pool
+  [[nodiscard]] auto Size() const -> size_t {
+    return strings_.size();
+  }
+
+private:
+  std::unique_ptr<common::Arena>                   arena_;    /// String storage
+  std::vector<std::string_view>                    strings_;  /// Id->string map, views `arena_`
+  common::FlatMultiMap<std::string_view, uint32_t> index_;    /// String->id map, keys view `arena_`
+};
+
+/// String pool(s) referenced by the interned components of a `SctRecord`
+struct SctStrings {
+  StringPool sources;  /// Source abbreviation(s), i.e. SAB
+  StringPool codes;    /// Source code(s), i.e. CODE
+};
+
+}  // namespace mapper
+}  // namespace termspp
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace termspp {
+namespace mapper {
+
+/// Pull-style line reader
+///   - Non-allocating: operates over a contiguous, read-only buffer, e.g. a `common::MappedFile`, and only ever
+///     hands out views into it, i.e. each line is only valid for the lifetime of the buffer
+///   - Lines are split on `\n`; the line terminator, incl. any preceding `\r`, is excluded from the view
+///   - A trailing line without a terminator is still emitted
+///
+class LineReader final {
+public:
+  explicit LineReader(std::string_view input) : cur_(input.data()), end_(input.data() + input.size()) {}
+
+  /// Advance to the next line, returning false once the buffer has been exhausted
+  [[nodiscard]] auto Next(std::string_view &line) -> bool {
+    if (cur_ == nullptr || cur_ >= end_) {
+      return false;
+    }
+
+    const auto *src = cur_;
+    const auto *eol = static_cast<const char *>(std::memchr(src, '\n', static_cast<size_t>(end_ - src)));
+    if (eol == nullptr) {
+      eol  = end_;
+      cur_ = end_;
+    } else {
+      cur_ = eol + 1;
+    }
+
+    if (eol > src && *(eol - 1) == '\r') {
+      --eol;
+    }
+
+    line = std::string_view{src, static_cast<size_t>(eol - src)};
+    return true;
+  }
+
+  /// Getter: the number of bytes remaining in the buffer
+  [[nodiscard]] auto Remaining() const -> size_t {
+    return cur_ != nullptr ? static_cast<size_t>(end_ - cur_) : 0;
+  }
+
+private:
+  const char *cur_;
+  const char *end_;
+};
+
+}  // namespace mapper
+}  // namespace termspp
@@ -1,15 +1,29 @@
 #pragma once
 
-#include "termspp/common/arena.hpp"
+#include "termspp/common/mapped.hpp"
+#include "termspp/common/stream.hpp"
 #include "termspp/mapper/defs.hpp"
+#include "termspp/mapper/index.hpp"
+#include "termspp/mapper/pool.hpp"
+#include "termspp/mapper/reader.hpp"
+#include "termspp/mapper/sort.hpp"
 
-#include "fastcsv/csv.h"
 #include "nonstd/expected.hpp"
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <string>
 #include <string_view>
-#include <tuple>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace termspp {
 namespace mapper {
@@ -23,14 +37,15 @@ namespace mapper {
 /// SCT<->MeSH Document
 ///   - Scts SCT & MeSH codes described in the following ref:
 ///     https://www.ncbi.nlm.nih.gov/books/NBK9685/table/ch03.T.concept_names_and_sources_file_mr/
+///   - The source file is memory-mapped & its rows are handed to the policies as views into the mapping; the
+///     mapping is released once parsed as records only reference the document's interned `SctStrings`
+///   - gzip/zstd-compressed files, FIFOs & stdin, i.e. `-`, are decompressed & read on a separate thread instead
+///     of being mapped, see `common::InputStream`
 ///
 /// [!] Issues:
 ///   - Policies here were used here when assessing how best to map the source documents; we should probably
 ///     move to a more definitive class at some point to reduce comp. times
 ///
-///   - Similarly, we're still incl. fastcsv as a dependency but we're only using it as a file reader now; we
-///     should just remove it and buffer the file ourselves
-///
 template <class DelimiterPolicy = ColumnDelimiter<>,
           class FilterPolicy    = NoRowFilter,
           class SelectorPolicy  = AllSelected,
@@ -43,16 +58,50 @@ class SctDocument final                                                  //
                                                       SctPolicy,         //
                                                       BuilderPolicy>> {  //
 
-  /// Arena allocator region size
-  static constexpr const size_t kArenaRegionSize{4096LL};
+  /// Size of the ranges parsed concurrently, each aligned to the beginning of a row
+  static constexpr const size_t kParallelChunkSize{1LL << 22};
+
+  /// Max. number of parsed ranges buffered per worker whilst awaiting their merge
+  static constexpr const size_t kChunksInFlight{2U};
 
   /// Policy typedef
   using SctDoc = SctDocument<DelimiterPolicy, FilterPolicy, SelectorPolicy, SctPolicy, BuilderPolicy>;
 
+  /// Candidate records buffered by a worker, pending their `SctPolicy` test, & the pool(s) their ids reference
+  struct SctChunk {
+    std::vector<SctRecord> records;
+    SctStrings             strings;
+  };
+
+  /// Describes the state of the records accepted whilst parsing
+  struct SctStream {
+    RecordIndex            keys;            // Key(s) of the accepted records, or of the current concept if streaming
+    std::vector<SctRecord> group;           // Records of the current concept, only used if streaming
+    uint32_t               uid{0};          // CUI of the current concept
+    bool                   started{false};  // Whether a concept has been seen
+    bool                   sorted{true};    // Whether the rows parsed so far were sorted by CUI
+  };
+
 public:
   /// Creates a new Sct document instance
-  static auto Load(const char *filepath) -> std::shared_ptr<SctDoc> {
-    return std::shared_ptr<SctDoc>(new SctDoc(filepath));
+  ///   - the document is parsed across `threads` workers, defaulting to the number of hardware threads if
+  ///     zero; the workers parse ranges of `kParallelChunkSize` bytes that are merged in file order as they're
+  ///     parsed, i.e. no more than `kChunksInFlight` ranges per worker are buffered at any one time
+  ///   - `SctLoadMode::kStreaming` groups records by CUI as they're parsed, bounding the records held in memory by
+  ///     the largest concept rather than every candidate record; the document falls back to `SctLoadMode::kBatch`
+  ///     if its rows aren't sorted by CUI
+  static auto Load(const char *filepath, SctLoadMode mode = SctLoadMode::kBatch, uint32_t threads = 0)
+    -> std::shared_ptr<SctDoc> {
+    return std::shared_ptr<SctDoc>(new SctDoc(filepath, FilterPolicy{}, mode, threads));
+  }
+
+  /// Creates a new Sct document instance, filtering its rows by the given `FilterPolicy` instance, see `Load()`
+  ///   - the filter is owned by the document, e.g. a stateful filter configured per document
+  static auto Load(const char  *filepath,
+                   FilterPolicy filter,
+                   SctLoadMode  mode    = SctLoadMode::kBatch,
+                   uint32_t     threads = 0) -> std::shared_ptr<SctDoc> {
+    return std::shared_ptr<SctDoc>(new SctDoc(filepath, std::move(filter), mode, threads));
   }
 
 public:
@@ -81,142 +130,534 @@ public:
     return result_;
   }
 
-  /// Getter: Get records contained by this instance
+  /// Getter: the load strategy of this document, i.e. `SctLoadMode::kBatch` if streaming fell back
+  [[nodiscard]] auto GetMode() const -> SctLoadMode {
+    return mode_;
+  }
+
+  /// Getter: Get records contained by this instance, ordered by CUI then SAB
   [[nodiscard]] auto GetRecords() -> RecordSct & {
     return records_;
   }
 
+  /// Getter: the string pool(s) referenced by the interned component(s) of this instance's records
+  [[nodiscard]] auto GetStrings() const -> const SctStrings & {
+    return strings_;
+  }
+
+  /// Resolve the interned component(s) of some record contained by this instance, e.g. for writing
+  [[nodiscard]] auto Resolve(const SctRecord &record) const -> SctEntry {
+    return SctEntry{
+      .uid = DecodeCui(record.uid),
+      .src = strings_.sources.Get(record.src),
+      .trg = strings_.codes.Get(record.trg),
+    };
+  }
+
+  /// Find the record(s) assoc. with some CUI
+  [[nodiscard]] auto FindRecords(std::string_view cui) const -> std::span<const SctRecord> {
+    uint32_t uid{0};
+    if (!EncodeCui(cui, uid)) {
+      return {};
+    }
+
+    const auto range = std::equal_range(records_.begin(), records_.end(), SctRecord{.uid = uid, .trg = 0, .src = 0},
+                                        [](const SctRecord &lhs, const SctRecord &rhs) {
+                                          return lhs.uid < rhs.uid;
+                                        });
+
+    return std::span<const SctRecord>{range.first, range.second};
+  }
+
 private:
   /// Builds a unique map across MeSH & SCT xrefs from file
-  auto buildSctping(const char *filepath) -> void {
-    auto result = parseFile(filepath);
+  auto buildSctping(const char *filepath, uint32_t threads) -> void {
+    auto stream = SctStream{};
+    auto result = parseFile(filepath, threads, stream);
+
+    // Unsorted rows can't be streamed, i.e. reparse the document as a batch if it can be read again
+    if (mode_ == SctLoadMode::kStreaming && !stream.sorted) {
+      if (!common::InputStream::IsRereadable(filepath)) {
+        result_ = common::Result{common::Status::kPolicyErr, "expected rows sorted by CUI when streaming from a pipe"};
+        return;
+      }
+
+      mode_    = SctLoadMode::kBatch;
+      records_ = RecordSct{};
+      strings_ = SctStrings{};
+      stream   = SctStream{};
+      result   = parseFile(filepath, threads, stream);
+    }
+
     if (!result.Ok()) {
       result_ = result;
       return;
     }
 
-    auto rec_iter = records_.begin();
-    while (rec_iter != records_.end()) {
-      auto record  = rec_iter->second;
-      auto *source = record.srcBuf;
+    // Streamed concepts are already ordered & pruned
+    if (mode_ == SctLoadMode::kStreaming) {
+      flushGroup(stream);
+      result_ = result;
+      return;
+    }
 
-      const auto *sibling = std::strncmp(source, kMeshSab, std::strlen(kMeshSab)) == 0  //
-                              ? kSnomedSab                                              //
-                              : kMeshSab;                                               //
+    // Order by CUI then by the name of each record's SAB, retaining the file order of any equivalent record(s)
+    auto ranks   = std::vector<uint32_t>(strings_.sources.Size());
+    auto sources = std::vector<uint32_t>(strings_.sources.Size());
+    std::iota(sources.begin(), sources.end(), 0U);
+    std::sort(sources.begin(), sources.end(), [this](uint32_t lhs, uint32_t rhs) {
+      return strings_.sources.Get(lhs) < strings_.sources.Get(rhs);
+    });
 
-      auto clen  = std::strlen(sibling);
-      auto range = records_.equal_range(std::string_view{record.uidBuf});
+    for (uint32_t rank = 0; rank < sources.size(); ++rank) {
+      ranks[sources[rank]] = rank;
+    }
 
-      // Find records with valid xrefs
-      auto has_sibling = std::any_of(range.first, range.second, [sibling, clen](const auto &rec) {
-        return std::strncmp(rec.second.srcBuf, sibling, clen) == 0;
+    SortRecords(records_, ranks, threads);
+
+    auto output = records_.begin();
+    for (auto iter = records_.begin(); iter != records_.end();) {
+      const auto uid  = iter->uid;
+      const auto next = std::find_if(iter, records_.end(), [uid](const SctRecord &record) {
+        return record.uid != uid;
       });
 
-      // Erase key-value pairs in which no mapping was made between a SNOMED + MeSH code
-      if (!has_sibling) {
-        rec_iter = records_.erase(range.first, range.second);
-        continue;
+      // Erase records in which no mapping was made between a SNOMED + MeSH code
+      if (hasSibling(std::span<const SctRecord>{iter, next})) {
+        output = std::move(iter, next, output);
       }
 
       // Advance to next key
-      rec_iter = range.second;
+      iter = next;
     }
+    records_.erase(output, records_.end());
 
     result_ = result;
   }
 
+  /// Test whether the records of a concept describe a valid xref, i.e. whether they contain both a MeSH & a SNOMED
+  /// record, regardless of their order
+  ///   - record(s) of any other vocabulary are retained alongside a valid xref but never form one by themselves,
+  ///     e.g. a concept describing ICD10CM & SNOMED code(s) only is erased
+  [[nodiscard]] auto hasSibling(std::span<const SctRecord> group) const -> bool {
+    auto has_mesh   = false;
+    auto has_snomed = false;
+    for (const auto &record : group) {
+      const auto sab = strings_.sources.Get(record.src);
+      has_mesh       = has_mesh || sab.starts_with(kMeshSab);
+      has_snomed     = has_snomed || sab.starts_with(kSnomedSab);
+      if (has_mesh && has_snomed) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /// Accept a built record, testing it against the records accepted so far
+  ///   - if streaming, the records of each concept are buffered until the CUI changes; returns false if the
+  ///     CUI precedes the current concept, i.e. the rows aren't sorted by CUI
+  [[nodiscard]] auto acceptRecord(const SctRecord &record, SctStream &stream) -> bool {
+    if (mode_ == SctLoadMode::kStreaming) {
+      if (stream.started && record.uid != stream.uid) {
+        if (record.uid < stream.uid) {
+          stream.sorted = false;
+          return false;
+        }
+
+        flushGroup(stream);
+      }
+
+      stream.uid     = record.uid;
+      stream.started = true;
+    }
+
+    if (SctPolicy::ShouldSct(record, stream.keys)) {
+      auto &records = mode_ == SctLoadMode::kStreaming ? stream.group : records_;
+      records.emplace_back(record);
+      stream.keys.Insert(record);
+    }
+
+    return true;
+  }
+
+  /// Emit the records of the current concept if they describe a valid xref, ordered by the name of their SAB
+  auto flushGroup(SctStream &stream) -> void {
+    auto &group = stream.group;
+    if (!group.empty()) {
+      std::stable_sort(group.begin(), group.end(), [this](const SctRecord &lhs, const SctRecord &rhs) {
+        return strings_.sources.Get(lhs.src) < strings_.sources.Get(rhs.src);
+      });
+
+      if (hasSibling(group)) {
+        records_.insert(records_.end(), group.begin(), group.end());
+      }
+
+      group.clear();
+    }
+
+    stream.keys.Clear();
+  }
+
   /// Responsible for parsing the document from file according to the given policies
-  [[nodiscard]] auto parseFile(const char *filepath) -> common::Result {
-    if (!std::filesystem::exists(filepath)) {
+  ///   - if more than one thread is requested, the file is split into newline-aligned ranges that are parsed
+  ///     concurrently into their own string pool(s), see `parseRanges()`; the records of each range are then
+  ///     re-interned, tested by the `SctPolicy` & merged in file order, i.e. the result is identical to a serial
+  ///     parse
+  ///   - compressed files, FIFOs & stdin can't be mapped, see `parseStream()`
+  [[nodiscard]] auto parseFile(const char *filepath, uint32_t threads, SctStream &stream) -> common::Result {
+    const auto is_stdin = std::string_view{filepath} == common::InputStream::kStdinPath;
+    if (!is_stdin && !std::filesystem::exists(filepath)) {
       return common::Result{common::Status::kFileNotFoundErr};
     }
 
-    auto reader = std::unique_ptr<io::LineReader>();
-    allocator_  = common::Arena::Create(kArenaRegionSize);
-    try {
-      reader = std::make_unique<io::LineReader>(filepath);
-    } catch (const std::exception &err) {
-      return common::Result{common::Status::kFileInitErr, err.what()};
+    if (!common::InputStream::IsMappable(filepath)) {
+      return parseStream(filepath, stream);
     }
 
-    try {
-      char *line{nullptr};
-      while ((line = reader->next_line()) && line) {
-        // Parse col(s) per the given policy
-        auto row = DelimiterPolicy::ParseLine(line);
-        if (row.status != common::Status::kSuccessful) {
+    auto mapping = common::MappedFile::Create(filepath);
+    if (!mapping.has_value()) {
+      return mapping.error();
+    }
+
+    // Rows are consumed front to back, i.e. read ahead & reclaim the pages behind the reader
+    mapping.value()->Advise(common::MappedAccess::kSequential);
+
+    // Split the document into ranges aligned to the beginning of a row
+    const auto window = mapping.value()->View();
+
+    auto bounds = std::vector<size_t>{0};
+    while (threads > 1 && window.size() - bounds.back() > kParallelChunkSize) {
+      const auto offset = window.find('\n', bounds.back() + kParallelChunkSize);
+      if (offset == std::string_view::npos || offset + 1 >= window.size()) {
+        break;
+      }
+
+      bounds.emplace_back(offset + 1);
+    }
+    bounds.emplace_back(window.size());
+
+    if (bounds.size() > 2) {
+      return parseRanges(window, bounds, std::min<size_t>(threads, bounds.size() - 1), stream);
+    }
+
+    // Serial: test each record against those parsed so far
+    return parseRange(window, [this, &stream](const SctRow &row) -> common::Result {
+      return acceptRow(row, stream);
+    });
+  }
+
+  /// Parses the document serially from a (decompressing) stream, see `common::InputStream`
+  ///   - rows spanning two blocks are carried over to the next; records never reference a block since their
+  ///     component(s) are interned
+  [[nodiscard]] auto parseStream(const char *filepath, SctStream &stream) -> common::Result {
+    auto input = common::InputStream::Open(filepath);
+    if (!input.has_value()) {
+      return input.error();
+    }
+
+    auto sink = [this, &stream](const SctRow &row) -> common::Result {
+      return acceptRow(row, stream);
+    };
+
+    auto carry = std::string{};
+    auto block = std::string_view{};
+    while (input.value()->Next(block)) {
+      // Complete the row carried over from the previous block
+      if (!carry.empty()) {
+        const auto offset = block.find('\n');
+        if (offset == std::string_view::npos) {
+          carry.append(block);
           continue;
         }
 
-        // Filter row by predicate
-        if (FilterPolicy::Filter(row)) {
-          continue;
+        carry.append(block.substr(0, offset + 1));
+        block.remove_prefix(offset + 1);
+
+        auto result = parseRange(carry, sink);
+        if (!result) {
+          return result;
         }
+        carry.clear();
+      }
 
-        // Select column(s) by func
-        SelectorPolicy::Select(row);
+      // Parse the block's complete row(s) & carry over the remainder
+      const auto last = block.rfind('\n');
+      if (last == std::string_view::npos) {
+        carry.assign(block);
+        continue;
+      }
 
-        // Ensure mappable e.g. uniqueness of column(s) by predicate
-        if (row.status != common::Status::kSuccessful || !SctPolicy::ShouldSct(row, records_)) {
-          continue;
+      auto result = parseRange(block.substr(0, last + 1), sink);
+      if (!result) {
+        return result;
+      }
+      carry.assign(block.substr(last + 1));
+    }
+
+    auto result = input.value()->GetResult();
+    if (!result) {
+      return result;
+    }
+
+    return carry.empty() ? result : parseRange(carry, sink);
+  }
+
+  /// Builds & accepts a row selected by the policies
+  [[nodiscard]] auto acceptRow(const SctRow &row, SctStream &stream) -> common::Result {
+    auto record = buildRecord(strings_, row.cols);
+    if (!record.has_value()) {
+      return record.error();
+    }
+
+    if (!acceptRecord(record.value(), stream)) {
+      return common::Result{common::Status::kPolicyErr, "expected rows sorted by CUI"};
+    }
+
+    return common::Result{common::Status::kSuccessful};
+  }
+
+  /// Parses the ranges across `workers` thread(s) whilst merging them in file order on the calling thread
+  ///   - each range is merged as soon as it's parsed, & released thereafter, whilst the ranges following it are
+  ///     still being parsed; workers stall rather than claim a range more than `workers * kChunksInFlight` ranges
+  ///     ahead of the merge, i.e. the buffered records are bounded by the ranges in flight rather than the file
+  [[nodiscard]] auto parseRanges(std::string_view           window,
+                                 const std::vector<size_t> &bounds,
+                                 size_t                     workers,
+                                 SctStream                 &stream) -> common::Result {
+    const auto ranges  = bounds.size() - 1;
+    const auto limit   = workers * kChunksInFlight;
+    auto       results = std::vector<common::Result>(ranges);
+    auto       outputs = std::vector<SctChunk>(ranges);
+    auto       parsed  = std::vector<bool>(ranges, false);
+
+    auto mutex     = std::mutex{};
+    auto condition = std::condition_variable{};
+    auto claimed   = size_t{0};
+    auto merged    = size_t{0};
+    auto halted    = false;
+
+    auto work = [&]() {
+      while (true) {
+        auto index = size_t{0};
+        {
+          auto lock = std::unique_lock{mutex};
+          condition.wait(lock, [&] { return halted || claimed >= ranges || claimed < merged + limit; });
+          if (halted || claimed >= ranges) {
+            return;
+          }
+
+          index = claimed++;
         }
 
-        // Alloc & record
-        auto [cols, size, status] = row;
-        auto result               = allocRow(row.cols, row.size);
-        if (!result.has_value()) {
-          return result.error();
+        auto &output = outputs[index];
+
+        const auto range = window.substr(bounds[index], bounds[index + 1] - bounds[index]);
+        results[index]   = parseRange(range, [&output](const SctRow &row) -> common::Result {
+          auto record = buildRecord(output.strings, row.cols);
+          if (!record.has_value()) {
+            return record.error();
+          }
+
+          output.records.emplace_back(record.value());
+          return common::Result{common::Status::kSuccessful};
+        });
+
+        {
+          auto lock     = std::lock_guard{mutex};
+          parsed[index] = true;
         }
+        condition.notify_all();
+      }
+    };
 
-        auto record = result.value();
-        records_.emplace(SctKey{record.uidBuf, record.srcBuf, record.trgBuf}, record);
+    auto pool = std::vector<std::thread>{};
+    pool.reserve(workers);
+    for (size_t index = 0; index < workers; ++index) {
+      pool.emplace_back(work);
+    }
+
+    // Merge in file order as each range is parsed, releasing its record(s) & pool(s) once merged
+    auto result = common::Result{common::Status::kSuccessful};
+    for (size_t index = 0; index < ranges; ++index) {
+      {
+        auto lock = std::unique_lock{mutex};
+        condition.wait(lock, [&] { return parsed[index]; });
+      }
+
+      result         = results[index] ? mergeChunk(outputs[index], stream) : results[index];
+      outputs[index] = SctChunk{};
+
+      {
+        auto lock = std::lock_guard{mutex};
+        merged    = index + 1;
+        halted    = !result;
+      }
+      condition.notify_all();
+
+      if (!result) {
+        break;
+      }
+    }
+
+    for (auto &thread : pool) {
+      thread.join();
+    }
+
+    return result;
+  }
+
+  /// Merges a parsed range, mapping its interned id(s) to those of this instance & accepting its record(s)
+  [[nodiscard]] auto mergeChunk(const SctChunk &output, SctStream &stream) -> common::Result {
+    auto sources = std::vector<uint32_t>(output.strings.sources.Size());
+    auto codes   = std::vector<uint32_t>(output.strings.codes.Size());
+    for (uint32_t id = 0; id < sources.size(); ++id) {
+      sources[id] = strings_.sources.Intern(output.strings.sources.Get(id));
+      if (sources[id] > kMaxSourceId) {
+        return common::Result{common::Status::kAllocationErr, "failed to intern source abbreviation"};
+      }
+    }
+
+    for (uint32_t id = 0; id < codes.size(); ++id) {
+      codes[id] = strings_.codes.Intern(output.strings.codes.Get(id));
+      if (codes[id] == StringPool::kInvalidId) {
+        return common::Result{common::Status::kAllocationErr, "failed to intern code"};
+      }
+    }
+
+    for (auto record : output.records) {
+      record.src = static_cast<uint16_t>(sources[record.src]);
+      record.trg = codes[record.trg];
+      if (!acceptRecord(record, stream)) {
+        return common::Result{common::Status::kPolicyErr, "expected rows sorted by CUI"};
       }
-    } catch (const std::exception &err) {
-      return common::Result{common::Status::kLineReaderErr, err.what()};
     }
 
     return common::Result{common::Status::kSuccessful};
   }
 
-  /// Allocates a record to this instance's arena and packs it into a struct
-  [[nodiscard]] auto allocRow(const SctCols &row, const uint64_t &size) -> nonstd::expected<SctRecord, common::Result> {
-    // Alloc record size
-    uint8_t *ptr{nullptr};
-    if (!allocator_->Allocate(static_cast<int64_t>(size), &ptr)) {
-      auto out = std::ostringstream{};
-      out << "Unable to allocate row of Size<"  //
-          << size                               //
-          << "> with data:\n\t| ";              //
+  /// Parses each row of a range according to the given policies, handing each selected row to the sink
+  template <typename Sink>
+    requires(!BatchFilterPolicy<FilterPolicy>)
+  [[nodiscard]] auto parseRange(std::string_view range, Sink &&sink) const -> common::Result {
+    auto reader = LineReader{range};
+    auto line   = std::string_view{};
+    while (reader.Next(line)) {
+      // Parse col(s) per the given policy
+      auto row = DelimiterPolicy::ParseLine(line);
+      if (row.status != common::Status::kSuccessful) {
+        continue;
+      }
 
-      auto str = std::string{};
-      for (auto [iter, end, index] = std::tuple{row.begin(), row.end(), 0}; iter != end; ++iter, ++index) {
-        str.assign(iter->data(), iter->length());
+      // Filter row by predicate
+      if (filter_.Filter(row)) {
+        continue;
+      }
 
-        out << str                                //
-            << (iter == end - 1 ? " |" : " | ");  //
+      // Select column(s) by func
+      SelectorPolicy::Select(row);
+      if (row.status != common::Status::kSuccessful) {
+        continue;
       }
 
-      return nonstd::make_unexpected(common::Result{common::Status::kAllocationErr, out.str()});
+      auto result = sink(row);
+      if (!result) {
+        return result;
+      }
     }
 
-    // Build record by some func
-    auto result = SctRecord{nullptr, nullptr, nullptr};
-    if (!BuilderPolicy::Build(row, ptr, result)) {
-      return nonstd::make_unexpected(common::Result{common::Status::kPolicyErr, "failed to build record"});
+    return common::Result{common::Status::kSuccessful};
+  }
+
+  /// Parses each row of a range into blocks of up to `kFilterBatchSize` rows, filtering each block by a
+  /// `BatchFilterPolicy` before its selected rows are handed to the sink in order
+  ///   - rows view the range, i.e. each block remains valid until the range is exhausted
+  template <typename Sink>
+    requires BatchFilterPolicy<FilterPolicy>
+  [[nodiscard]] auto parseRange(std::string_view range, Sink &&sink) const -> common::Result {
+    auto rows     = std::array<SctRow, kFilterBatchSize>{};
+    auto filtered = std::array<bool, kFilterBatchSize>{};
+
+    // Select the unfiltered row(s) of the current block & hand them to the sink
+    const auto flush = [this, &rows, &filtered, &sink](size_t count) -> common::Result {
+      filter_.FilterBatch(std::span{rows.data(), count}, std::span{filtered.data(), count});
+      for (size_t index = 0; index < count; ++index) {
+        if (filtered[index]) {
+          continue;
+        }
+
+        auto &row = rows[index];
+        SelectorPolicy::Select(row);
+        if (row.status != common::Status::kSuccessful) {
+          continue;
+        }
+
+        auto result = sink(row);
+        if (!result) {
+          return result;
+        }
+      }
+
+      return common::Result{common::Status::kSuccessful};
+    };
+
+    auto   reader = LineReader{range};
+    auto   line   = std::string_view{};
+    size_t count{0};
+    while (reader.Next(line)) {
+      // Parse col(s) per the given policy
+      rows[count] = DelimiterPolicy::ParseLine(line);
+      if (rows[count].status != common::Status::kSuccessful) {
+        continue;
+      }
+
+      if (++count == kFilterBatchSize) {
+        auto result = flush(std::exchange(count, 0));
+        if (!result) {
+          return result;
+        }
+      }
+    }
+
+    if (count > 0) {
+      return flush(count);
+    }
+
+    return common::Result{common::Status::kSuccessful};
+  }
+
+  /// Builds a record from some row, interning its component(s) into the given pool(s)
+  [[nodiscard]] static auto buildRecord(SctStrings &strings, const SctCols &row)
+    -> nonstd::expected<SctRecord, common::Result> {
+    auto result = SctRecord{};
+    if (!BuilderPolicy::Build(row, strings, result)) {
+      auto out = std::ostringstream{};
+      out << "Unable to build record from row with data:\n\t| ";
+
+      for (auto iter = row.begin(); iter != row.end(); ++iter) {
+        out << *iter                              //
+            << (iter == row.end() - 1 ? " |" : " | ");  //
+      }
+
+      return nonstd::make_unexpected(common::Result{common::Status::kPolicyErr, out.str()});
     }
 
     return result;
   }
 
 private:
-  common::Result                 result_;     /// Parsing result & document validity
-  RecordSct                      records_;    /// Sct records
-  std::unique_ptr<common::Arena> allocator_;  /// Arena allocator
+  common::Result result_;   /// Parsing result & document validity
+  SctLoadMode    mode_;     /// Load strategy of this document
+  FilterPolicy   filter_;   /// Row filter
+  RecordSct      records_;  /// Sct records
+  SctStrings     strings_;  /// String pool(s) referenced by `records_`
 
 protected:
   /// Sct document constructor
-  explicit SctDocument(const char *filepath) {
-    buildSctping(filepath);
+  SctDocument(const char *filepath, FilterPolicy filter, SctLoadMode mode, uint32_t threads)
+      : mode_(mode)
+      , filter_(std::move(filter)) {
+    buildSctping(filepath, threads > 0 ? threads : std::max(std::thread::hardware_concurrency(), 1U));
   }
 };
 
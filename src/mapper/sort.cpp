@@ -0,0 +1,139 @@
+#include "termspp/mapper/sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mapper = ::termspp::mapper;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Radix sort const.
+constexpr const size_t kRadixBits     = 8U;                /// Key bit(s) consumed per pass
+constexpr const size_t kRadixBuckets  = 1U << kRadixBits;  /// Buckets per pass
+constexpr const size_t kRadixKeyBits  = 48U;               /// Key width, i.e. a 32-bit CUI & a 16-bit SAB rank
+constexpr const size_t kRadixRankBits = 16U;               /// Key bit(s) describing the SAB rank
+constexpr const size_t kMinRadixBlock = 1U << 16;          /// Min. number of records sorted by each worker
+
+/// Describes the bucket counts, or offsets, of a single worker
+typedef std::array<size_t, kRadixBuckets> RadixCounts;
+
+/// Run some func across a number of workers, the calling thread acting as the first
+template <typename Func>
+auto runWorkers(size_t workers, Func &&func) -> void {
+  auto pool = std::vector<std::thread>{};
+  pool.reserve(workers - 1);
+  for (size_t worker = 1; worker < workers; ++worker) {
+    pool.emplace_back(func, worker);
+  }
+
+  func(0);
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+/************************************************************
+ *                                                          *
+ *                           Sort                           *
+ *                                                          *
+ ************************************************************/
+
+auto mapper::SortRecords(std::vector<SctRecord> &records, std::span<const uint32_t> ranks, uint32_t threads)
+  -> void {
+  const auto count = records.size();
+  if (count < 2) {
+    return;
+  }
+
+  const auto workers = std::max<size_t>(1, std::min<size_t>(threads, count / kMinRadixBlock + 1));
+  const auto block   = (count + workers - 1) / workers;
+
+  const auto key_of = [ranks](const SctRecord &record) -> uint64_t {
+    return (static_cast<uint64_t>(record.uid) << kRadixRankBits) | ranks[record.src];
+  };
+
+  const auto range_of = [count, block](size_t worker) -> std::pair<size_t, size_t> {
+    const auto start = std::min(count, worker * block);
+    return {start, std::min(count, start + block)};
+  };
+
+  // Find the key bit(s) that vary across the records, i.e. those of the digits worth sorting by
+  auto masks = std::vector<std::pair<uint64_t, uint64_t>>(workers, {0ULL, ~0ULL});
+  runWorkers(workers, [&](size_t worker) {
+    const auto [start, end] = range_of(worker);
+
+    auto &[any, all] = masks[worker];
+    for (auto index = start; index < end; ++index) {
+      const auto key  = key_of(records[index]);
+      any            |= key;
+      all            &= key;
+    }
+  });
+
+  // A bit varies if it's set by any record but not by every record, i.e. across every worker's block
+  uint64_t any_or{0};
+  uint64_t all_and{~0ULL};
+  for (const auto &[any, all] : masks) {
+    any_or  |= any;
+    all_and &= all;
+  }
+
+  const auto varying = any_or & ~all_and;
+
+  auto  buffer = std::vector<SctRecord>{};
+  auto  counts = std::vector<RadixCounts>(workers);
+  auto *input  = records.data();
+  auto *output = static_cast<SctRecord *>(nullptr);
+  for (size_t shift = 0; shift < kRadixKeyBits; shift += kRadixBits) {
+    if (((varying >> shift) & (kRadixBuckets - 1)) == 0) {
+      continue;
+    }
+
+    if (buffer.empty()) {
+      buffer.resize(count);
+      output = buffer.data();
+    }
+
+    // Count each worker's digit(s)
+    runWorkers(workers, [&](size_t worker) {
+      const auto [start, end] = range_of(worker);
+
+      auto &local = counts[worker];
+      local.fill(0);
+      for (auto index = start; index < end; ++index) {
+        local[(key_of(input[index]) >> shift) & (kRadixBuckets - 1)]++;
+      }
+    });
+
+    // Offset each worker's bucket(s) after the preceding digit(s) & the preceding worker(s) of the same digit
+    size_t offset{0};
+    for (size_t digit = 0; digit < kRadixBuckets; ++digit) {
+      for (auto &local : counts) {
+        offset += std::exchange(local[digit], offset);
+      }
+    }
+
+    // Scatter each worker's block
+    runWorkers(workers, [&](size_t worker) {
+      const auto [start, end] = range_of(worker);
+
+      auto &local = counts[worker];
+      for (auto index = start; index < end; ++index) {
+        output[local[(key_of(input[index]) >> shift) & (kRadixBuckets - 1)]++] = input[index];
+      }
+    });
+
+    std::swap(input, output);
+  }
+
+  if (input != records.data()) {
+    records.swap(buffer);
+  }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "termspp/mapper/defs.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace termspp {
+namespace mapper {
+
+/// Sort records by their CUI, then by the rank of their SAB, retaining the order of any equivalent record(s)
+///   - `ranks` maps each source id to its rank, e.g. the order of the source names; expected to fit in 16 bits
+///   - records are sorted by an LSD radix sort of their 48-bit (CUI, rank) key, 8 bits per pass; passes whose
+///     digit is shared by every record are skipped
+///   - each pass is split across `threads` workers, each counting & then scattering its own block of records;
+///     blocks are scattered in order such that the sort remains stable
+auto SortRecords(std::vector<SctRecord> &records, std::span<const uint32_t> ranks, uint32_t threads) -> void;
+
+}  // namespace mapper
+}  // namespace termspp
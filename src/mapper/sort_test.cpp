@@ -0,0 +1,93 @@
+#include "termspp/mapper/sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+namespace mapper = ::termspp::mapper;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Number of records per case, i.e. enough to split the sort across several workers
+constexpr const size_t kTestRecords = (1U << 16) * 4 + 17;
+
+/// Number of distinct source ids
+constexpr const uint16_t kTestSources = 200U;
+
+/// Describes the records of a test case
+enum class SortCase : uint8_t {
+  kRandom,   /// Random CUI(s) & source(s)
+  kBlocks,   /// Each worker's block shares a CUI, i.e. its digit(s) are constant within, but not across, blocks
+  kSorted,   /// Already sorted by CUI, sharing every high bit but the last worker's
+  kSources,  /// A single CUI, i.e. only the SAB rank varies
+};
+
+/// Build the records of a test case
+auto makeRecords(SortCase kind, std::mt19937_64 &rng) -> std::vector<mapper::SctRecord> {
+  auto records = std::vector<mapper::SctRecord>(kTestRecords);
+  for (size_t index = 0; index < records.size(); ++index) {
+    auto &record = records[index];
+    record.trg   = static_cast<uint32_t>(index);
+    record.src   = static_cast<uint16_t>(rng() % kTestSources);
+
+    switch (kind) {
+    case SortCase::kRandom:
+      record.uid = static_cast<uint32_t>(rng() % 5000000U);
+      break;
+    case SortCase::kBlocks:
+      record.uid = static_cast<uint32_t>(index < records.size() / 2 ? 0x00010203U : 0x0A0B0C0DU);
+      break;
+    case SortCase::kSorted:
+      record.uid = static_cast<uint32_t>(index < records.size() - 8 ? 0x00FF0000U : 0x00FF0001U);
+      break;
+    case SortCase::kSources:
+      record.uid = 0x00ABCDEFU;
+      break;
+    }
+  }
+
+  return records;
+}
+
+/************************************************************
+ *                                                          *
+ *                           Main                           *
+ *                                                          *
+ ************************************************************/
+
+/// Test `SortRecords()` against `std::stable_sort()` across a number of workers
+auto main() -> int {
+  auto ranks = std::vector<uint32_t>(kTestSources);
+  for (uint32_t id = 0; id < ranks.size(); ++id) {
+    ranks[id] = (id * 37U) % kTestSources;
+  }
+
+  auto rng    = std::mt19937_64{42};
+  auto failed = 0;
+  for (const auto kind : {SortCase::kRandom, SortCase::kBlocks, SortCase::kSorted, SortCase::kSources}) {
+    const auto records = makeRecords(kind, rng);
+
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [&ranks](const auto &lhs, const auto &rhs) {
+      return lhs.uid != rhs.uid ? lhs.uid < rhs.uid : ranks[lhs.src] < ranks[rhs.src];
+    });
+
+    for (const uint32_t threads : {1U, 2U, 3U, 4U, 7U}) {
+      auto actual = records;
+      mapper::SortRecords(actual, ranks, threads);
+      if (actual != expected) {
+        std::fprintf(stderr, "case %d, %u thread(s): expected stable order\n", static_cast<int>(kind), threads);
+        failed++;
+      }
+    }
+  }
+
+  return failed == 0 ? 0 : 1;
+}
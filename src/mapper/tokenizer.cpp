@@ -0,0 +1,182 @@
+#include "termspp/mapper/tokenizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TERMSPP_TOKENIZER_X86 1
+#endif
+
+namespace mapper = ::termspp::mapper;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Number of bytes scanned per block
+constexpr const size_t kBlockSize{64U};
+
+/// Records the delimiter(s) described by the set bits of a block's mask
+///   - returns false once scanning should stop, i.e. a newline was found or `out` is full
+auto emitBlock(const char         *block,
+               uint64_t            mask,
+               uint32_t            base,
+               char                token,
+               std::span<uint32_t> out,
+               size_t             &count) -> bool {
+  while (mask != 0) {
+    const auto bit = static_cast<uint32_t>(std::countr_zero(mask));
+    if (block[bit] != token || count == out.size()) {
+      return false;
+    }
+
+    out[count++]  = base + bit;
+    mask         &= mask - 1;
+  }
+
+  return true;
+}
+
+/// Copies the trailing partial block of a row into a zeroed buffer such that a kernel may always load 64 bytes
+auto loadTail(std::string_view input, size_t offset, std::array<char, kBlockSize> &tail) -> const char * {
+  tail.fill(0);
+  std::memcpy(tail.data(), input.data() + offset, input.size() - offset);
+  return tail.data();
+}
+
+/// Scalar fallback
+auto findScalar(std::string_view input, char token, std::span<uint32_t> out) -> size_t {
+  size_t count{0};
+  for (size_t index = 0; index < input.size(); ++index) {
+    const auto chr = input[index];
+    if (chr == '\n') {
+      break;
+    }
+
+    if (chr == token) {
+      if (count == out.size()) {
+        break;
+      }
+
+      out[count++] = static_cast<uint32_t>(index);
+    }
+  }
+
+  return count;
+}
+
+#ifdef TERMSPP_TOKENIZER_X86
+/// SSE2 kernel, available on every x86-64 host
+///   - SSE4.2's string instructions, i.e. `pcmpistrm`, are slower than a pair of byte compares for a set of two
+__attribute__((target("sse2"))) auto findSse2(std::string_view input, char token, std::span<uint32_t> out)
+  -> size_t {
+  const auto dlm = _mm_set1_epi8(token);
+  const auto eol = _mm_set1_epi8('\n');
+
+  alignas(kBlockSize) std::array<char, kBlockSize> tail;
+
+  size_t count{0};
+  for (size_t offset = 0; offset < input.size(); offset += kBlockSize) {
+    const auto *block = offset + kBlockSize <= input.size() ? input.data() + offset : loadTail(input, offset, tail);
+
+    uint64_t mask{0};
+    for (size_t lane = 0; lane < kBlockSize / 16; ++lane) {
+      const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + lane * 16));
+      const auto found = _mm_or_si128(_mm_cmpeq_epi8(chars, dlm), _mm_cmpeq_epi8(chars, eol));
+      mask            |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(found))) << (lane * 16);
+    }
+
+    if (!emitBlock(block, mask, static_cast<uint32_t>(offset), token, out, count)) {
+      break;
+    }
+  }
+
+  return count;
+}
+
+/// AVX2 kernel
+__attribute__((target("avx2"))) auto findAvx2(std::string_view input, char token, std::span<uint32_t> out)
+  -> size_t {
+  const auto dlm = _mm256_set1_epi8(token);
+  const auto eol = _mm256_set1_epi8('\n');
+
+  alignas(kBlockSize) std::array<char, kBlockSize> tail;
+
+  size_t count{0};
+  for (size_t offset = 0; offset < input.size(); offset += kBlockSize) {
+    const auto *block = offset + kBlockSize <= input.size() ? input.data() + offset : loadTail(input, offset, tail);
+
+    const auto lo    = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+    const auto hi    = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+    const auto lmask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(lo, dlm), _mm256_cmpeq_epi8(lo, eol)));
+    const auto hmask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(hi, dlm), _mm256_cmpeq_epi8(hi, eol)));
+    const auto mask  = static_cast<uint64_t>(static_cast<uint32_t>(lmask))  //
+                    | (static_cast<uint64_t>(static_cast<uint32_t>(hmask)) << 32);
+
+    if (!emitBlock(block, mask, static_cast<uint32_t>(offset), token, out, count)) {
+      break;
+    }
+  }
+
+  return count;
+}
+#endif
+
+/// Resolve the widest instruction set supported by this host
+auto resolveIsa() -> mapper::TokenizerIsa {
+#ifdef TERMSPP_TOKENIZER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return mapper::TokenizerIsa::kAvx2;
+  }
+
+  if (__builtin_cpu_supports("sse2")) {
+    return mapper::TokenizerIsa::kSse2;
+  }
+#endif
+
+  return mapper::TokenizerIsa::kScalar;
+}
+
+/************************************************************
+ *                                                          *
+ *                        Tokenizer                         *
+ *                                                          *
+ ************************************************************/
+
+auto mapper::GetTokenizerIsa() -> mapper::TokenizerIsa {
+  static const auto kIsa = resolveIsa();
+  return kIsa;
+}
+
+auto mapper::FindColumns(std::string_view input, char token, std::span<uint32_t> out) -> size_t {
+  return FindColumns(input, token, out, GetTokenizerIsa());
+}
+
+auto mapper::FindColumns(std::string_view input, char token, std::span<uint32_t> out, mapper::TokenizerIsa isa)
+  -> size_t {
+  if (input.empty() || out.empty()) {
+    return 0;
+  }
+
+  // Never exceed the host's capabilities
+  isa = std::min(isa, GetTokenizerIsa());
+
+#ifdef TERMSPP_TOKENIZER_X86
+  switch (isa) {
+  case mapper::TokenizerIsa::kAvx2:
+    return findAvx2(input, token, out);
+  case mapper::TokenizerIsa::kSse2:
+    return findSse2(input, token, out);
+  default:
+    break;
+  }
+#endif
+
+  return findScalar(input, token, out);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace termspp {
+namespace mapper {
+
+/// Instruction set(s) available to `FindColumns()`
+enum class TokenizerIsa : uint8_t {
+  kScalar,  // Portable byte-at-a-time fallback
+  kSse2,    // 4x 16-byte compares per 64-byte block
+  kAvx2,    // 2x 32-byte compares per 64-byte block
+};
+
+/// Getter: the widest instruction set supported by this host, resolved once on first use
+[[nodiscard]] auto GetTokenizerIsa() -> TokenizerIsa;
+
+/// Find the offset of each delimiter within a row
+///   - the row is scanned in 64-byte blocks, each block producing a bitmask of its delimiter & newline bytes,
+///     i.e. the cost is per block rather than per byte
+///   - scanning stops at the first `\n`, at the end of the input, or once `out` is full
+///   - returns the number of offsets written to `out`; column `i` spans `[out[i - 1] + 1, out[i])`
+auto FindColumns(std::string_view input, char token, std::span<uint32_t> out) -> size_t;
+
+/// Find the offset of each delimiter within a row using the given instruction set
+///   - falls back to `TokenizerIsa::kScalar` if the instruction set isn't supported by this host
+auto FindColumns(std::string_view input, char token, std::span<uint32_t> out, TokenizerIsa isa) -> size_t;
+
+}  // namespace mapper
+}  // namespace termspp
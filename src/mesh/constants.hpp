@@ -28,14 +28,14 @@ constexpr const char *kStringField = "String";  // char[*]: Inner text of which
 ///   - Note that we're intentionally ignoring the relationships defined by `<ConceptRelation />` here as
 ///     we're mostly using MeSH as a lookup
 ///
-constexpr const char *kRecordSetNode = "DescriptorRecordSet";      // [ Root]: Document root
-constexpr const char *kRecordNode    = "DescriptorRecord";         // [Child]: <DescriptorRecordSet/>'s child
-constexpr const char *kConcListNode  = "ConceptList";              // [Child]: <DescriptorRecord/>'s child
-constexpr const char *kConcNode      = "Concept";                  // [Child]: <ConceptList/>'s child
-constexpr const char *kTermListNode  = "TermList";                 // [Child]: <DescriptorRecord/>'s child
-constexpr const char *kTermNode      = "Term";                     // [Child]: <TermList/>'s child
-constexpr const char *kQualListNode  = "AllowableQualifiersList";  // [Child]: <DescriptRecord/>'s child
-constexpr const char *kQualNode      = "AllowableQualifier";       // [Child]: <AllowableQualifiersList/>'s child
+constexpr const char *kConcListNode = "ConceptList";              // [Child]: <*Record/>'s child
+constexpr const char *kConcNode     = "Concept";                  // [Child]: <ConceptList/>'s child
+constexpr const char *kTermListNode = "TermList";                 // [Child]: <DescriptorRecord/>'s child
+constexpr const char *kTermNode     = "Term";                     // [Child]: <TermList/>'s child
+constexpr const char *kQualListNode = "AllowableQualifiersList";  // [Child]: <DescriptRecord/>'s child
+constexpr const char *kQualNode     = "AllowableQualifier";       // [Child]: <AllowableQualifiersList/>'s child
+constexpr const char *kTreeListNode = "TreeNumberList";           // [Child]: <DescriptorRecord/>'s child
+constexpr const char *kTreeNode     = "TreeNumber";               // [Child]: <TreeNumberList/>'s child
 
 /// MeSH XML attributes
 ///
@@ -43,6 +43,7 @@ constexpr const char *kQualNode      = "AllowableQualifier";       // [Child]: <
 ///   - Note that we're mapping these to the `mesh::MeshModifier` enum
 ///
 constexpr const char *kDescClassAttr = "DescriptorClass";         // uint8_t: Specifies whether indexable
+constexpr const char *kSuppClassAttr = "SCRClass";                // uint8_t: Specifies the supplementary class
 constexpr const char *kConcPrefAttr  = "PreferredConceptYN";      // char[1]: Specifies descriptor preference (Y/N)
 constexpr const char *kTermConcAttr  = "ConceptPreferredTermYN";  // char[1]: Specifies concept preference (Y/N)
 constexpr const char *kTermDescAttr  = "RecordPreferredTermYN";   // char[1]: Specifies descriptor preference (Y/N)
@@ -1,13 +1,16 @@
 #pragma once
 
+#include "termspp/common/staticmap.hpp"
+
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <compare>
 #include <ostream>
+#include <string>
 #include <string_view>
 #include <type_traits>
-#include <unordered_map>
-#include <vector>
 
 namespace termspp {
 namespace mesh {
@@ -27,13 +30,25 @@ auto ToString(T &value) ->
 /// MeSH record alignment
 constexpr const size_t kMeshRecordAlignment{8U};
 
+/// MeSH document load strategies
+enum class MeshLoadMode : uint8_t {
+  kDocument,   // Load the entire XML document into memory before parsing its records
+  kStreaming,  // Read & parse the XML document one `<DescriptorRecord />` at a time, bounding memory by record size
+  kMapped,     // Map the XML document into memory & parse it in place; records reference the mapping where possible
+  kParallel,   // Same as `kMapped` but the document's records are parsed across multiple threads
+  kSnapshot,   // Map a binary snapshot written by `MeshDocument::WriteSnapshot()`, i.e. no parsing is required
+};
+
 /// MeSH XML node types
 enum class MeshType : uint8_t {
-  kUnknown,           // Unknown|Invalid
-  kDescriptorRecord,  // https://www.nlm.nih.gov/mesh/xml_data_elements.html#DescriptorRecord
-  kQualifier,         // https://www.nlm.nih.gov/mesh/xml_data_elements.html#AllowableQualifier
-  kConcept,           // https://www.nlm.nih.gov/mesh/xml_data_elements.html#Concept
-  kTerm,              // https://www.nlm.nih.gov/mesh/xml_data_elements.html#Term
+  kUnknown,             // Unknown|Invalid
+  kDescriptorRecord,    // https://www.nlm.nih.gov/mesh/xml_data_elements.html#DescriptorRecord
+  kQualifier,           // https://www.nlm.nih.gov/mesh/xml_data_elements.html#AllowableQualifier
+  kConcept,             // https://www.nlm.nih.gov/mesh/xml_data_elements.html#Concept
+  kTerm,                // https://www.nlm.nih.gov/mesh/xml_data_elements.html#Term
+  kSupplementalRecord,  // https://www.nlm.nih.gov/mesh/xml_data_elements.html#SupplementalRecord
+  kQualifierRecord,     // https://www.nlm.nih.gov/mesh/xml_data_elements.html#QualifierRecord
+  kTreeNumber,          // https://www.nlm.nih.gov/mesh/xml_data_elements.html#TreeNumber
 };
 
 /// MeSH XML node categories
@@ -52,6 +67,10 @@ enum class MeshCategory : uint8_t {
   kTermSupplementary,
   kTermConceptPref,
   kTermDescriptorPref,
+  // <SupplementalRecord />
+  kSupplementalRegular,
+  kSupplementalProtocol,
+  kSupplementalRareDisease,
 };
 
 /// MeSH XML attribute modifiers
@@ -72,30 +91,162 @@ enum class MeshModifier : uint8_t {
   kTermLexNam,  // Proper name
 };
 
+/// MeSH UID type prefixes
+///   - e.g. the `D` of `D012711`
+enum class MeshUidTag : uint8_t {
+  kUnknown,       // Null|Unknown|Invalid
+  kDescriptor,    // `D`, e.g. `D012711`
+  kQualifier,     // `Q`, e.g. `Q000008`
+  kConcept,       // `M`, e.g. `M0000003`
+  kTerm,          // `T`, e.g. `T000009`
+  kSupplemental,  // `C`, e.g. `C000002`
+};
+
+/// MeSH UID prefix characters, indexed by `mesh::MeshUidTag`
+///   - the first char is a placeholder for `MeshUidTag::kUnknown`
+constexpr const std::string_view kMeshUidPrefixes{"_DQMTC"};
+
+/// Compact MeSH UID
+///   - MeSH UIDs are a one-letter type prefix followed by a fixed-width decimal number, these are packed into a
+///     32-bit integer such that hashing & comparison doesn't need to inspect the UID's text
+///   - layout (MSB->LSB): 3-bit `mesh::MeshUidTag`, 4-bit digit width, 25-bit numeric value
+///   - the zero value describes an empty/invalid UID
+struct MeshUid {
+  static constexpr const uint32_t kTagShift{29U};
+  static constexpr const uint32_t kWidthShift{25U};
+  static constexpr const uint32_t kWidthMask{0xFU};
+  static constexpr const uint32_t kValueMask{(1U << kWidthShift) - 1U};
+  static constexpr const size_t   kMaxLength{16U};
+
+  uint32_t code{0};  // Packed UID
+
+  /// Attempt to encode a MeSH UID from its text
+  ///   - returns an invalid UID if the text isn't a known prefix followed by 1-15 digits, or if its numeric
+  ///     value exceeds 25 bits; note that an empty UID is encoded as an invalid UID
+  [[nodiscard]] static constexpr auto FromString(std::string_view text) -> MeshUid {
+    if (text.size() < 2 || text.size() > kMaxLength) {
+      return MeshUid{};
+    }
+
+    const auto tag = kMeshUidPrefixes.find(text.front(), 1);
+    if (tag == std::string_view::npos) {
+      return MeshUid{};
+    }
+
+    uint32_t value{0};
+    for (const auto chr : text.substr(1)) {
+      if (chr < '0' || chr > '9') {
+        return MeshUid{};
+      }
+
+      value = value * 10U + static_cast<uint32_t>(chr - '0');
+      if (value > kValueMask) {
+        return MeshUid{};
+      }
+    }
+
+    const auto width = static_cast<uint32_t>(text.size() - 1);
+    return MeshUid{static_cast<uint32_t>(tag) << kTagShift | width << kWidthShift | value};
+  }
+
+  /// Getter: whether this UID describes a valid MeSH UID
+  [[nodiscard]] constexpr auto Valid() const -> bool {
+    return code != 0;
+  }
+
+  /// Getter: the type prefix of this UID
+  [[nodiscard]] constexpr auto Tag() const -> MeshUidTag {
+    return static_cast<MeshUidTag>(code >> kTagShift);
+  }
+
+  /// Getter: the numeric value of this UID
+  [[nodiscard]] constexpr auto Value() const -> uint32_t {
+    return code & kValueMask;
+  }
+
+  /// Getter: the number of digits of this UID's numeric part
+  [[nodiscard]] constexpr auto Width() const -> uint32_t {
+    return (code >> kWidthShift) & kWidthMask;
+  }
+
+  /// Decodes this UID into the output buffer, returning the number of bytes written
+  ///   - `out` is expected to be at least `kMaxLength` bytes; nothing is written if this UID is invalid
+  constexpr auto Write(char *out) const -> size_t {
+    if (!Valid()) {
+      return 0;
+    }
+
+    const auto width = Width();
+    auto       value = Value();
+    out[0]           = kMeshUidPrefixes[static_cast<size_t>(Tag())];
+    for (auto index = width; index > 0; --index) {
+      out[index]  = static_cast<char>('0' + value % 10U);
+      value      /= 10U;
+    }
+
+    return width + 1;
+  }
+
+  /// Decodes this UID into a string
+  [[nodiscard]] auto ToString() const -> std::string {
+    char buf[kMaxLength];
+    return std::string{buf, Write(buf)};
+  }
+
+  constexpr auto operator==(const MeshUid &other) const -> bool = default;
+  constexpr auto operator<=>(const MeshUid &other) const       = default;
+
+  friend auto operator<<(std::ostream &stream, const MeshUid &obj)->std::ostream & {
+    char buf[kMaxLength];
+    return stream.write(buf, static_cast<std::streamsize>(obj.Write(buf)));
+  }
+};
+
+/// `mesh::MeshUid` hash functor
+///   - UIDs are mostly sequential, their code is scrambled by a Fibonacci multiplier to spread them across the
+///     high & low bits of the hash
+struct MeshUidHash {
+  constexpr auto operator()(const MeshUid &uid) const -> size_t {
+    const auto hash = static_cast<uint64_t>(uid.code) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash ^ (hash >> 29));
+  }
+};
+
 /// MeSH record
 ///   - i.e. output shape of the parsed data
+///   - the name isn't guaranteed to be null terminated, e.g. it may reference a memory-mapped document
 struct alignas(kMeshRecordAlignment) MeshRecord {
-  char        *buf;        // UID + name buf (separated by null term)
-  const char  *parentUid;  // Buf containing this element's parent UID (if any)
-  uint16_t     uidLen;     // Length of the UID string described by `buf` & the name offset
-  uint16_t     nameLen;    // Length the name string described by `buf`
+  const char  *name;       // Name string
+  MeshUid      uid;        // Encoded UID
+  MeshUid      parentUid;  // This element's parent's encoded UID (if any)
+  uint16_t     nameLen;    // Length of the name string described by `name`
   MeshType     type;       // Sctped MeSH element type from its corresponding XML node
   MeshCategory category;   // MeSH category/subclass derived from the XML node
   MeshModifier modifier;   // Any assoc. modifier(s) assoc. with this element derived from its attributes
 
+  /// Getter: this record's UID
+  [[nodiscard]] auto Uid() const -> MeshUid {
+    return uid;
+  }
+
+  /// Getter: view this record's name
+  [[nodiscard]] auto Name() const -> std::string_view {
+    return std::string_view{name, nameLen};
+  }
+
+  /// Getter: this record's parent UID, invalid if it doesn't have a parent
+  [[nodiscard]] auto ParentUid() const -> MeshUid {
+    return parentUid;
+  }
+
   friend auto operator<<(std::ostream &stream, const MeshRecord &obj)->std::ostream & {
     // clang-format off
-    auto *name = obj.buf + obj.uidLen + 1;
-    auto puid = obj.parentUid != nullptr
-        ? std::string_view{obj.parentUid, std::strlen(obj.parentUid)}
-        : std::string_view{};
-
-    return stream << std::string_view{obj.buf, obj.uidLen}  << "|"   //
-                  << std::string_view{name, obj.nameLen}    << "|"   //
-                  << puid                                   << "|"   //
-                  << ToString(obj.type)                     << "|"   //
-                  << ToString(obj.category)                 << "|"   //
-                  << ToString(obj.modifier)                 << "\n"; //
+    return stream << obj.Uid()                << "|"   //
+                  << obj.Name()               << "|"   //
+                  << obj.ParentUid()          << "|"   //
+                  << ToString(obj.type)       << "|"   //
+                  << ToString(obj.category)   << "|"   //
+                  << ToString(obj.modifier)   << "\n"; //
     // clang-format on
   }
 };
@@ -123,41 +274,91 @@ struct MeshTermAttr {
   MeshModifier mod;
 };
 
-/// Describes fields associated with a specific MeSH XML node type
-static const auto kNodeFields = []() {
-  return std::vector<MeshFields>{
-    {"DescriptorUI", "DescriptorName", MeshType::kDescriptorRecord,  true, false},
-    { "QualifierUI",  "QualifierName",        MeshType::kQualifier,  true,  true},
-    {   "ConceptUI",    "ConceptName",          MeshType::kConcept,  true, false},
-    {      "TermUI",          nullptr,             MeshType::kTerm, false, false}
-  };
+/// Describes the root & record elements of a MeSH XML document
+struct MeshRecordSet {
+  const char *setNode;     // Document root, e.g. `<DescriptorRecordSet />`
+  const char *recordNode;  // Record element(s) contained by the root, e.g. `<DescriptorRecord />`
+  MeshType    recordType;  // MeSH type of the record element(s)
 };
 
-/// Scts MeSH XML node names to known MeSH types
-static const auto kNodeTypes = []() {
-  return std::unordered_map<std::string_view, MeshType>{
-    {  "DescriptorRecord", MeshType::kDescriptorRecord},
-    {"AllowableQualifier",        MeshType::kQualifier},
-    {           "Concept",          MeshType::kConcept},
-    {              "Term",             MeshType::kTerm},
-  };
+/// Describes the MeSH XML document(s) to load
+///   - each file is optional, e.g. only the descriptor file is needed to resolve `D` codes but `C` codes are
+///     only resolvable if the supplementary file has been loaded
+struct MeshSources {
+  const char *descriptors{nullptr};    // `<DescriptorRecordSet />` file, e.g. desc2024.xml
+  const char *qualifiers{nullptr};     // `<QualifierRecordSet />` file, e.g. qual2024.xml
+  const char *supplementals{nullptr};  // `<SupplementalRecordSet />` file, e.g. supp2024.xml
 };
 
+/// Describes the known MeSH XML record sets
+constexpr const std::array<MeshRecordSet, 3> kRecordSets{{
+  {  "DescriptorRecordSet",   "DescriptorRecord",    MeshType::kDescriptorRecord},
+  {   "QualifierRecordSet",    "QualifierRecord",     MeshType::kQualifierRecord},
+  {"SupplementalRecordSet", "SupplementalRecord", MeshType::kSupplementalRecord},
+}};
+
+/// Describes fields associated with a specific MeSH XML node type
+///   - a MeSH type is expected to be described at most once, see `FindNodeFields()`
+constexpr const std::array<MeshFields, 6> kNodeFields{{
+  {        "DescriptorUI",         "DescriptorName",    MeshType::kDescriptorRecord,  true, false},
+  {         "QualifierUI",          "QualifierName",           MeshType::kQualifier,  true,  true},
+  {           "ConceptUI",            "ConceptName",             MeshType::kConcept,  true, false},
+  {              "TermUI",                  nullptr,                MeshType::kTerm, false, false},
+  {"SupplementalRecordUI", "SupplementalRecordName", MeshType::kSupplementalRecord,  true, false},
+  {         "QualifierUI",          "QualifierName",     MeshType::kQualifierRecord,  true, false},
+}};
+
+/// Scts MeSH XML node names to known MeSH types
+constexpr const auto kNodeTypes = common::StaticMap<MeshType, 6>{{{
+  {  "DescriptorRecord",    MeshType::kDescriptorRecord},
+  {"AllowableQualifier",           MeshType::kQualifier},
+  {           "Concept",             MeshType::kConcept},
+  {              "Term",                MeshType::kTerm},
+  {"SupplementalRecord", MeshType::kSupplementalRecord},
+  {   "QualifierRecord",     MeshType::kQualifierRecord},
+}}};
+
 /// MeSH XML attribute modifier map
 ///   - used to map the XML Node's attribute value to its corresponding `mesh::MeshModifier`
-static const auto kMeshModifiers = []() {
-  return std::unordered_map<std::string_view, mesh::MeshModifier>{
-    {"NON", mesh::MeshModifier::kTermLexNon},
-    {"ABB", mesh::MeshModifier::kTermLexAbb},
-    {"ABX", mesh::MeshModifier::kTermLexAbx},
-    {"ACR", mesh::MeshModifier::kTermLexAcr},
-    {"ACX", mesh::MeshModifier::kTermLexAcx},
-    {"EPO", mesh::MeshModifier::kTermLexEpo},
-    {"LAB", mesh::MeshModifier::kTermLexLab},
-    {"TRD", mesh::MeshModifier::kTermLexTrd},
-    {"NAM", mesh::MeshModifier::kTermLexNam},
-  };
-};
+constexpr const auto kMeshModifiers = common::StaticMap<MeshModifier, 9>{{{
+  {"NON", mesh::MeshModifier::kTermLexNon},
+  {"ABB", mesh::MeshModifier::kTermLexAbb},
+  {"ABX", mesh::MeshModifier::kTermLexAbx},
+  {"ACR", mesh::MeshModifier::kTermLexAcr},
+  {"ACX", mesh::MeshModifier::kTermLexAcx},
+  {"EPO", mesh::MeshModifier::kTermLexEpo},
+  {"LAB", mesh::MeshModifier::kTermLexLab},
+  {"TRD", mesh::MeshModifier::kTermLexTrd},
+  {"NAM", mesh::MeshModifier::kTermLexNam},
+}}};
+
+/// MeSH type->`kNodeFields` index table, derived from `kNodeFields` at compile time
+constexpr const auto kNodeFieldIndex = []() {
+  auto index = std::array<uint8_t, 1U << (sizeof(MeshType) * 8)>{};
+  index.fill(kNodeFields.size());
+  for (size_t offset = 0; offset < kNodeFields.size(); ++offset) {
+    index[static_cast<size_t>(kNodeFields[offset].nodeType)] = static_cast<uint8_t>(offset);
+  }
+
+  return index;
+}();
+
+/// Find the fields assoc. with a MeSH node type, returning `nullptr` if it isn't described by `kNodeFields`
+constexpr auto FindNodeFields(MeshType type) -> const MeshFields * {
+  const auto offset = kNodeFieldIndex[static_cast<size_t>(type)];
+  return offset < kNodeFields.size() ? &kNodeFields[offset] : nullptr;
+}
+
+/// Find the record set whose record element is of the given MeSH type, returning `nullptr` if it's unknown
+constexpr auto FindRecordSet(MeshType type) -> const MeshRecordSet * {
+  for (const auto &set : kRecordSets) {
+    if (set.recordType == type) {
+      return &set;
+    }
+  }
+
+  return nullptr;
+}
 
 }  // namespace mesh
 }  // namespace termspp
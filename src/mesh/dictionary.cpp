@@ -0,0 +1,221 @@
+#include "termspp/mesh/dictionary.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace mesh   = ::termspp::mesh;
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// ASCII fold(s) of the Latin-1 supplement's letters, i.e. U+00C0 to U+00FF encoded as `0xC3 0x80..0xBF`
+///   - `nullptr` describes a symbol, e.g. `×`, which is treated as a word boundary
+constexpr const std::array<const char *, 64> kLatin1Folds{
+  "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",       // U+00C0 - U+00CF
+  "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "ss",  // U+00D0 - U+00DF
+  "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",       // U+00E0 - U+00EF
+  "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "y",   // U+00F0 - U+00FF
+};
+
+/// Describes a word within the normaliser's scratch buffer
+struct TermToken {
+  uint32_t offset;  // Offset of the word's first char
+  uint32_t size;    // Size of the word in bytes
+};
+
+/// Test whether some byte is a UTF-8 continuation byte
+constexpr auto isContinuation(uint8_t chr) -> bool {
+  return (chr & 0xC0U) == 0x80U;
+}
+
+/// Size of the UTF-8 sequence beginning with the given lead byte
+constexpr auto sequenceSize(uint8_t chr) -> size_t {
+  if (chr >= 0xF0U) {
+    return 4;
+  }
+
+  if (chr >= 0xE0U) {
+    return 3;
+  }
+
+  return chr >= 0xC0U ? 2 : 1;
+}
+
+/************************************************************
+ *                                                          *
+ *                      MeshDictionary                      *
+ *                                                          *
+ ************************************************************/
+
+auto mesh::MeshDictionary::Normalise(std::string_view text, std::span<char> out) -> size_t {
+  // Scratch space is intentionally left uninitialised, only the bytes written below are ever read
+  std::array<char, kMaxTermLength>      scratch;
+  std::array<TermToken, kMaxTermTokens> tokens;
+
+  size_t count{0};   // Number of words
+  size_t length{0};  // Number of bytes written to the scratch buffer
+  bool   open{false};
+
+  // Append some char(s) to the current word, opening a new word if required
+  auto append = [&](const char *chars, size_t size) -> bool {
+    if (length + size > scratch.size()) {
+      return false;
+    }
+
+    if (!open) {
+      if (count == tokens.size()) {
+        return false;
+      }
+
+      tokens[count++] = TermToken{.offset = static_cast<uint32_t>(length), .size = 0};
+      open            = true;
+    }
+
+    std::memcpy(scratch.data() + length, chars, size);
+    tokens[count - 1].size += static_cast<uint32_t>(size);
+    length                 += size;
+    return true;
+  };
+
+  for (size_t index = 0; index < text.size();) {
+    const auto chr  = static_cast<uint8_t>(text[index]);
+    const auto next = index + 1 < text.size() ? static_cast<uint8_t>(text[index + 1]) : uint8_t{0};
+
+    // ASCII: alphanumerics are folded, anything else is a word boundary
+    if (chr < 0x80U) {
+      if ((chr >= 'a' && chr <= 'z') || (chr >= '0' && chr <= '9')) {
+        if (!append(&text[index], 1)) {
+          return kInvalidTerm;
+        }
+      } else if (chr >= 'A' && chr <= 'Z') {
+        const auto lower = static_cast<char>(chr + ('a' - 'A'));
+        if (!append(&lower, 1)) {
+          return kInvalidTerm;
+        }
+      } else {
+        open = false;
+      }
+
+      index += 1;
+      continue;
+    }
+
+    // Latin-1 supplement: letters are folded, symbols (incl. U+00A0) are word boundaries
+    if ((chr == 0xC2U || chr == 0xC3U) && isContinuation(next)) {
+      const auto *fold = chr == 0xC3U ? kLatin1Folds[next - 0x80U] : nullptr;
+      if (fold == nullptr) {
+        open = false;
+      } else if (!append(fold, std::strlen(fold))) {
+        return kInvalidTerm;
+      }
+
+      index += 2;
+      continue;
+    }
+
+    // Combining diacritical marks, i.e. U+0300 to U+036F, are dropped
+    if ((chr == 0xCCU || (chr == 0xCDU && next <= 0xAFU)) && isContinuation(next)) {
+      index += 2;
+      continue;
+    }
+
+    // Any other sequence is retained as-is
+    const auto size = std::min(sequenceSize(chr), text.size() - index);
+    if (!append(&text[index], size)) {
+      return kInvalidTerm;
+    }
+    index += size;
+  }
+
+  // Canonicalise the word order & join each word by a single space
+  auto word = [&](const TermToken &token) {
+    return std::string_view{scratch.data() + token.offset, token.size};
+  };
+
+  std::sort(tokens.begin(), tokens.begin() + count, [&](const TermToken &lhs, const TermToken &rhs) {
+    return word(lhs) < word(rhs);
+  });
+
+  size_t size{0};
+  for (size_t index = 0; index < count; ++index) {
+    const auto elem = word(tokens[index]);
+    if (size + elem.size() + (index > 0 ? 1 : 0) > out.size()) {
+      return kInvalidTerm;
+    }
+
+    if (index > 0) {
+      out[size++] = ' ';
+    }
+
+    std::memcpy(out.data() + size, elem.data(), elem.size());
+    size += elem.size();
+  }
+
+  return size;
+}
+
+auto mesh::MeshDictionary::Build(const mesh::MeshStore &store) -> mesh::MeshDictionary {
+  auto dict = mesh::MeshDictionary{};
+
+  // Normalised names are never larger than their source, i.e. the pool is never reallocated whilst it's viewed
+  size_t capacity{0};
+  for (uint32_t row = 0; row < store.Size(); ++row) {
+    capacity += store.Name(row).size();
+  }
+  dict.keys_.reserve(capacity);
+  dict.index_.Reserve(store.Size(), store.Size());
+
+  auto buffer = std::array<char, kMaxTermLength>{};
+  for (uint32_t row = 0; row < store.Size(); ++row) {
+    const auto name = store.Name(row);
+    if (name.empty()) {
+      continue;
+    }
+
+    const auto size = Normalise(name, buffer);
+    if (size == kInvalidTerm || size == 0 || dict.keys_.size() + size > capacity) {
+      continue;
+    }
+
+    // Only the first occurrence of a normalised name is pooled, the key of an existing group is retained
+    const auto uid      = store.Uid(row);
+    const auto existing = dict.index_.Find(std::string_view{buffer.data(), size});
+    if (!existing.empty()) {
+      if (std::find(existing.begin(), existing.end(), uid) == existing.end()) {
+        dict.index_.Insert(std::string_view{buffer.data(), size}, uid);
+      }
+      continue;
+    }
+
+    const auto offset = dict.keys_.size();
+    dict.keys_.insert(dict.keys_.end(), buffer.begin(), buffer.begin() + static_cast<ptrdiff_t>(size));
+    dict.index_.Insert(std::string_view{dict.keys_.data() + offset, size}, uid);
+  }
+
+  return dict;
+}
+
+auto mesh::MeshDictionary::Find(std::string_view text) const -> std::span<const mesh::MeshUid> {
+  std::array<char, kMaxTermLength> buffer;
+
+  const auto size = Normalise(text, buffer);
+  if (size == kInvalidTerm || size == 0) {
+    return {};
+  }
+
+  return index_.Find(std::string_view{buffer.data(), size});
+}
+
+auto mesh::MeshDictionary::FindAll(std::span<const std::string_view>         texts,
+                                   std::span<std::span<const mesh::MeshUid>> out) const -> void {
+  const auto count = std::min(texts.size(), out.size());
+  for (size_t index = 0; index < count; ++index) {
+    out[index] = Find(texts[index]);
+  }
+}
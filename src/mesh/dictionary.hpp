@@ -0,0 +1,63 @@
+#pragma once
+
+#include "termspp/common/flatmap.hpp"
+#include "termspp/mesh/defs.hpp"
+#include "termspp/mesh/store.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace termspp {
+namespace mesh {
+
+/// Exact-match dictionary of normalised MeSH names
+///   - every named row of a `MeshStore` is indexed by the normalised form of its name, see `Normalise()`, such
+///     that free text resolves to the UID(s) of each record sharing its normalised form
+///   - lookups normalise into a stack buffer & probe the index in place, i.e. they never allocate
+///
+class MeshDictionary final {
+public:
+  /// Maximum size of a normalised name; longer names aren't indexed & longer text never matches
+  static constexpr const size_t kMaxTermLength{1024U};
+
+  /// Maximum number of words contained by a normalised name; names with more words aren't indexed
+  static constexpr const size_t kMaxTermTokens{128U};
+
+  /// Describes text that couldn't be normalised, i.e. it exceeded `kMaxTermLength` or `kMaxTermTokens`
+  static constexpr const size_t kInvalidTerm{std::string_view::npos};
+
+public:
+  MeshDictionary() = default;
+
+  /// Normalise some text into the given buffer, returning the size of the normalised text or `kInvalidTerm`
+  ///   - ASCII is case-folded & Latin-1 diacritics are stripped, e.g. `Ménière` -> `meniere`; combining
+  ///     diacritical marks are dropped & any other non-ASCII character is retained as-is
+  ///   - runs of whitespace & punctuation are collapsed into word boundaries
+  ///   - words are sorted & joined by a single space, e.g. `Neoplasms, Lung` -> `lung neoplasms`
+  static auto Normalise(std::string_view text, std::span<char> out) -> size_t;
+
+  /// Builds the dictionary from the names of a store's rows
+  [[nodiscard]] static auto Build(const MeshStore &store) -> MeshDictionary;
+
+  /// Getter: the number of distinct normalised names contained by this dictionary
+  [[nodiscard]] auto Size() const -> size_t {
+    return index_.KeyCount();
+  }
+
+  /// Find the UID(s) of the records whose normalised name matches the normalised text
+  [[nodiscard]] auto Find(std::string_view text) const -> std::span<const MeshUid>;
+
+  /// Find the UID(s) assoc. with each text of a batch
+  ///   - `out` is expected to be sized to at least `texts.size()`, each result is written to the
+  ///     corresponding index & is empty if the text didn't match
+  auto FindAll(std::span<const std::string_view> texts, std::span<std::span<const MeshUid>> out) const -> void;
+
+private:
+  std::vector<char>                               keys_;   /// Contiguous pool of normalised names
+  common::FlatMultiMap<std::string_view, MeshUid> index_;  /// Normalised name->UID(s) map, keys view `keys_`
+};
+
+}  // namespace mesh
+}  // namespace termspp
@@ -1,15 +1,23 @@
 #include "termspp/mesh/parser.hpp"
 
+#include "termspp/common/scope.hpp"
+#include "termspp/common/stream.hpp"
 #include "termspp/common/strings.hpp"
 #include "termspp/mesh/constants.hpp"
+#include "termspp/mesh/reader.hpp"
 
 #include "nonstd/expected.hpp"
 #include "pugixml.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstdio>
-#include <cstdlib>
 #include <cstring>
 #include <filesystem>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 namespace mesh   = ::termspp::mesh;
 namespace common = ::termspp::common;
@@ -20,26 +28,45 @@ namespace common = ::termspp::common;
  *                                                          *
  ************************************************************/
 
+/// Split a worker budget across some file(s) in proportion to their size, giving each at least one worker
+///   - files whose size can't be determined, e.g. FIFOs & stdin, are given a single worker
+auto splitWorkers(uint32_t workers, const std::vector<const char *> &filepaths) -> std::vector<uint32_t> {
+  auto sizes = std::vector<uintmax_t>(filepaths.size(), 0);
+  auto total = uintmax_t{0};
+  for (size_t index = 0; index < filepaths.size(); ++index) {
+    auto error = std::error_code{};
+    if (std::filesystem::is_regular_file(filepaths[index], error)) {
+      const auto size = std::filesystem::file_size(filepaths[index], error);
+      sizes[index]    = error ? 0 : size;
+      total          += sizes[index];
+    }
+  }
+
+  auto shares = std::vector<uint32_t>(filepaths.size(), 1U);
+  if (total > 0) {
+    for (size_t index = 0; index < filepaths.size(); ++index) {
+      shares[index] = std::max<uint32_t>(1, static_cast<uint32_t>(workers * sizes[index] / total));
+    }
+  }
+
+  return shares;
+}
+
 /// Attempt to derive the record type from the node's children
 auto tryGetRecordType(const pugi::xml_node *node) -> nonstd::expected<mesh::MeshType, common::Result> {
-  const auto types = mesh::kNodeTypes();
-  const auto type  = types.find(node->name());
-  if (type == types.end()) {
+  const auto *type = mesh::kNodeTypes.Find(node->name());
+  if (type == nullptr) {
     return nonstd::make_unexpected(common::Result{common::Status::kUnknownNodeTypeErr});
   }
 
-  return type->second;
+  return *type;
 }
 
 /// Attempt to retrieve some MeSH node's top-level field(s)
 auto tryGetRecordFields(const mesh::MeshType &type,
                         const pugi::xml_node *node) -> nonstd::expected<mesh::MeshProps, common::Result> {
-  const auto fields = mesh::kNodeFields();
-  const auto schema = std::find_if(fields.begin(), fields.end(), [&](const mesh::MeshFields &elem) {
-    return elem.nodeType == type;
-  });
-
-  if (schema == fields.end()) {
+  const auto *schema = mesh::FindNodeFields(type);
+  if (schema == nullptr) {
     return nonstd::make_unexpected(common::Result{common::Status::kUnknownNodeTypeErr});
   }
 
@@ -70,45 +97,68 @@ auto tryGetRecordFields(const mesh::MeshType &type,
 }
 
 /// Attempt to derive the `DescriptorRecordSet` node's class
-auto tryGetDescriptorClass(const char *attr) -> nonstd::expected<mesh::MeshCategory, common::Result> {
-  auto status = common::Result{common::Status::kEmptyNodeDataErr};
-  if (attr == nullptr || attr[0] == '\0') {
-    return nonstd::make_unexpected(status);
+auto tryGetDescriptorClass(std::string_view attr) -> nonstd::expected<mesh::MeshCategory, common::Result> {
+  auto value  = uint8_t{0};
+  auto status = common::tryParseInteger(attr, value);
+  if (status == common::Status::kSuccessful && (value < 1 || value > 4)) {
+    status = common::Status::kInvalidDataTypeErr;
   }
 
-  auto result = mesh::MeshCategory::kUnknown;
-  try {
-    auto value = static_cast<mesh::MeshCategory>(std::strtoul(attr, nullptr, 0));
-    if (value > mesh::MeshCategory::kUnknown && value <= mesh::MeshCategory::kDescriptorGeographic) {
-      result = value;
-      status.SetStatus(common::Status::kSuccessful);
-    }
-  } catch (const std::exception &e) {
-    status.SetStatus(common::Status::kInvalidDataTypeErr);
+  if (status != common::Status::kSuccessful) {
+    return nonstd::make_unexpected(common::Result{status});
+  }
+
+  return static_cast<mesh::MeshCategory>(value);
+}
+
+/// Attempt to derive the `SupplementalRecord` node's class
+auto tryGetSupplementalClass(std::string_view attr) -> nonstd::expected<mesh::MeshCategory, common::Result> {
+  auto value  = uint8_t{0};
+  auto status = common::tryParseInteger(attr, value);
+  if (status == common::Status::kSuccessful && (value < 1 || value > 3)) {
+    status = common::Status::kInvalidDataTypeErr;
   }
 
-  if (!status) {
-    return nonstd::make_unexpected(status);
+  if (status != common::Status::kSuccessful) {
+    return nonstd::make_unexpected(common::Result{status});
   }
 
-  return result;
+  return static_cast<mesh::MeshCategory>(mesh::ToInteger(mesh::MeshCategory::kSupplementalRegular) + value - 1);
 }
 
 /// Attempt to retrieve the `<Concept />` node's preference attribute
-auto tryGetConceptPreference(const char *attr) -> nonstd::expected<mesh::MeshCategory, common::Result> {
-  auto status = common::Result{common::Status::kEmptyNodeDataErr};
-  if (attr == nullptr) {
-    return nonstd::make_unexpected(status);
+auto tryGetConceptPreference(std::string_view attr) -> nonstd::expected<mesh::MeshCategory, common::Result> {
+  auto preference = false;
+  auto status     = common::tryCoerceBoolean(attr, preference);
+  if (status != common::Status::kSuccessful) {
+    return nonstd::make_unexpected(common::Result{status});
   }
 
-  try {
-    auto preference = common::coerceIntoBoolean(std::string_view(attr));
-    return preference ? mesh::MeshCategory::kConceptPreferred : mesh::MeshCategory::kConceptNarrower;
-  } catch (const std::exception &e) {
-    status.SetStatus(common::Status::kInvalidDataTypeErr);
+  return preference ? mesh::MeshCategory::kConceptPreferred : mesh::MeshCategory::kConceptNarrower;
+}
+
+/// Attempt to derive the `<Term />` node's category & modifier from its attribute values
+///   - malformed preference attributes are ignored, i.e. the category falls through to the next preference
+auto tryGetTermAttributes(std::string_view descPref,
+                          std::string_view concPref,
+                          std::string_view lexTag) -> nonstd::expected<mesh::MeshTermAttr, common::Result> {
+  auto result = mesh::MeshTermAttr{
+    .cat = mesh::MeshCategory::kUnknown,
+    .mod = mesh::MeshModifier::kUnknown,
+  };
+
+  auto preference = false;
+  if (common::tryCoerceBoolean(descPref, preference) == common::Status::kSuccessful && preference) {
+    result.cat = mesh::MeshCategory::kTermDescriptorPref;
+  } else if (common::tryCoerceBoolean(concPref, preference) == common::Status::kSuccessful && preference) {
+    result.cat = mesh::MeshCategory::kTermConceptPref;
   }
 
-  return nonstd::make_unexpected(status);
+  if (lexTag.data() != nullptr) {
+    result.mod = mesh::kMeshModifiers.Get(lexTag, result.mod);
+  }
+
+  return result;
 }
 
 /// Attempt to retrieve the `<Term />` node's preference attribute
@@ -117,43 +167,217 @@ auto tryGetTermAttributes(const pugi::xml_node *node) -> nonstd::expected<mesh::
     return nonstd::make_unexpected(common::Result{common::Status::kNodeDoesNotExistErr});
   }
 
-  auto result = mesh::MeshTermAttr{
-    .cat = mesh::MeshCategory::kUnknown,
-    .mod = mesh::MeshModifier::kUnknown,
-  };
+  return tryGetTermAttributes(node->attribute(mesh::kTermDescAttr).value(),
+                              node->attribute(mesh::kTermConcAttr).value(),
+                              node->attribute(mesh::kTermLexAttr).value());
+}
 
-  // clang-format off
-  try {
-    const auto *pref = node->attribute(mesh::kTermDescAttr).value();
-    if (pref != nullptr) {
-      result.cat = common::coerceIntoBoolean(std::string_view(pref))
-        ? mesh::MeshCategory::kTermDescriptorPref
-        : result.cat;
-    }
-  } catch (const std::exception& e) {}
-
-  if (result.cat == mesh::MeshCategory::kUnknown) {
-    try {
-      const auto *pref = node->attribute(mesh::kTermConcAttr).value();
-      if (pref != nullptr) {
-        result.cat = common::coerceIntoBoolean(std::string_view(pref))
-          ? mesh::MeshCategory::kTermConceptPref
-          : result.cat;
-      }
-    } catch (const std::exception& e) {}
+/************************************************************
+ *                                                          *
+ *                    Streaming helpers                     *
+ *                                                          *
+ ************************************************************/
+
+/// Describes a record read from a `<DescriptorRecord />` element that's pending allocation
+struct PendingRecord {
+  std::string_view   uid;      // Raw UID text
+  std::string_view   name;     // Raw name text
+  bool               rawName;  // Whether the name was declared as CDATA
+  mesh::MeshType     type;     // MeSH element type
+  mesh::MeshCategory cat;      // MeSH category/subclass derived from the element's attributes
+  mesh::MeshModifier mod;      // MeSH modifier(s) derived from the element's attributes
+  uint32_t           depth;    // Depth of the record's element relative to the `<DescriptorRecord />`
+  int32_t            parent;   // Index of the parent record, if any
+  mesh::MeshUid      code;     // Encoded UID once committed
+};
+
+/// Describes the open element(s) of the `<DescriptorRecord />` being streamed
+struct StreamFrame {
+  std::string_view name;    // Element name
+  int32_t          record;  // Index of the record opened by this element, if any
+};
+
+/// Attempt to derive the record type of an element from its name & its ancestors
+///   - mirrors the traversal of `MeshDocument::iterateChildren()`, i.e. we're only interested in the
+///     descendants that are direct members of the record's lists
+auto tryGetStreamType(const std::vector<StreamFrame>   &frames,
+                      const std::vector<PendingRecord> &records,
+                      const mesh::MeshRecordSet        &set,
+                      std::string_view                  name) -> mesh::MeshType {
+  if (frames.empty()) {
+    return name == set.recordNode ? set.recordType : mesh::MeshType::kUnknown;
+  }
+
+  if (frames.size() < 2) {
+    return mesh::MeshType::kUnknown;
   }
-  // clang-format on
 
-  const auto *mod_value = node->attribute(mesh::kTermLexAttr).value();
-  if (mod_value != nullptr) {
-    const auto mods = mesh::kMeshModifiers();
-    const auto mod  = mods.find(mod_value);
-    if (mod != mods.end()) {
-      result.mod = mod->second;
+  const auto &list  = frames[frames.size() - 1];
+  const auto &owner = frames[frames.size() - 2];
+  if (owner.record < 0) {
+    return mesh::MeshType::kUnknown;
+  }
+
+  switch (records[owner.record].type) {
+  case mesh::MeshType::kDescriptorRecord:
+    if (list.name == mesh::kConcListNode && name == mesh::kConcNode) {
+      return mesh::MeshType::kConcept;
+    }
+
+    if (list.name == mesh::kQualListNode && name == mesh::kQualNode) {
+      return mesh::MeshType::kQualifier;
     }
+
+    if (list.name == mesh::kTreeListNode && name == mesh::kTreeNode) {
+      return mesh::MeshType::kTreeNumber;
+    }
+    break;
+
+  case mesh::MeshType::kSupplementalRecord:
+  case mesh::MeshType::kQualifierRecord:
+    if (list.name == mesh::kConcListNode && name == mesh::kConcNode) {
+      return mesh::MeshType::kConcept;
+    }
+    break;
+
+  case mesh::MeshType::kConcept:
+    if (list.name == mesh::kTermListNode && name == mesh::kTermNode) {
+      return mesh::MeshType::kTerm;
+    }
+    break;
+
+  default:
+    break;
   }
 
-  return result;
+  return mesh::MeshType::kUnknown;
+}
+
+/// Attempt to derive the category & modifier of a streamed record from its element's attributes
+auto tryGetStreamAttributes(const mesh::XmlReader &reader, PendingRecord &record) -> common::Result {
+  switch (record.type) {
+  case mesh::MeshType::kDescriptorRecord: {
+    const auto cat_result = tryGetDescriptorClass(reader.Attribute(mesh::kDescClassAttr));
+    if (!cat_result.has_value()) {
+      return cat_result.error();
+    }
+    record.cat = cat_result.value();
+  } break;
+
+  case mesh::MeshType::kConcept: {
+    const auto cat_result = tryGetConceptPreference(reader.Attribute(mesh::kConcPrefAttr));
+    if (!cat_result.has_value()) {
+      return cat_result.error();
+    }
+    record.cat = cat_result.value();
+  } break;
+
+  case mesh::MeshType::kTerm: {
+    const auto attr = tryGetTermAttributes(reader.Attribute(mesh::kTermDescAttr),
+                                           reader.Attribute(mesh::kTermConcAttr),
+                                           reader.Attribute(mesh::kTermLexAttr));
+    if (!attr.has_value()) {
+      return attr.error();
+    }
+
+    record.cat = attr->cat;
+    record.mod = attr->mod;
+  } break;
+
+  case mesh::MeshType::kSupplementalRecord: {
+    const auto cat_result = tryGetSupplementalClass(reader.Attribute(mesh::kSuppClassAttr));
+    if (!cat_result.has_value()) {
+      return cat_result.error();
+    }
+    record.cat = cat_result.value();
+  } break;
+
+  case mesh::MeshType::kQualifier:
+  case mesh::MeshType::kQualifierRecord:
+  case mesh::MeshType::kTreeNumber:
+    break;
+
+  default:
+    return common::Result{common::Status::kUnknownNodeTypeErr};
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+/// Assign a text node to the UID or name of its closest record per the record's `mesh::MeshFields` schema
+///   - mirrors `tryGetRecordFields()`, i.e. only the first text node of the first matching element is used
+///   - a `<TreeNumber />` has no schema, its own text describes its name
+auto assignStreamText(const std::vector<StreamFrame> &frames,
+                      std::vector<PendingRecord>     &records,
+                      std::string_view                text,
+                      bool                            isRaw) -> void {
+  int32_t owner{-1};
+  size_t  depth{0};
+  for (auto index = frames.size(); index > 0; --index) {
+    if (frames[index - 1].record >= 0) {
+      owner = frames[index - 1].record;
+      depth = frames.size() - index;
+      break;
+    }
+  }
+
+  if (owner < 0) {
+    return;
+  }
+
+  auto &record = records[owner];
+  if (record.type == mesh::MeshType::kTreeNumber) {
+    if (depth == 0 && record.name.data() == nullptr) {
+      record.name    = text;
+      record.rawName = isRaw;
+    }
+    return;
+  }
+
+  const auto *schema = mesh::FindNodeFields(record.type);
+  if (depth < 1 || schema == nullptr) {
+    return;
+  }
+
+  const auto offset = schema->isEncapsulated ? 1U : 0U;
+  const auto &elem  = frames.back().name;
+  if (record.uid.data() == nullptr && depth == 1 + offset && elem == schema->uidField) {
+    record.uid = text;
+  } else if (record.name.data() == nullptr && schema->isNamedField && depth == 2 + offset &&
+             frames[frames.size() - 2].name == schema->nameField) {
+    record.name    = text;
+    record.rawName = isRaw;
+  } else if (record.name.data() == nullptr && !schema->isNamedField && depth == 1 + offset &&
+             elem == mesh::kStringField) {
+    record.name    = text;
+    record.rawName = isRaw;
+  }
+}
+
+/// Test whether some raw text is only composed of whitespace
+auto isWhitespace(std::string_view text) -> bool {
+  return std::all_of(text.begin(), text.end(), [](char chr) {
+    return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r';
+  });
+}
+
+/// Find the beginning of the next record start tag within the window, if any
+auto findRecordStart(std::string_view window, size_t offset, const mesh::MeshRecordSet &set) -> size_t {
+  const auto tag = std::string{"<"} + set.recordNode;
+  while ((offset = window.find(tag, offset)) != std::string_view::npos) {
+    const auto next = offset + tag.size();
+    if (next >= window.size()) {
+      return std::string_view::npos;
+    }
+
+    const auto chr = window[next];
+    if (chr == '>' || chr == '/' || chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r') {
+      return offset;
+    }
+    offset = next;
+  }
+
+  return std::string_view::npos;
 }
 
 /************************************************************
@@ -162,13 +386,139 @@ auto tryGetTermAttributes(const pugi::xml_node *node) -> nonstd::expected<mesh::
  *                                                          *
  ************************************************************/
 
-mesh::MeshDocument::MeshDocument(const char *filepath) {
+mesh::MeshDocument::MeshDocument(const mesh::MeshSources &sources, mesh::MeshLoadMode mode, uint32_t threads)
+    : mode_(mode) {
   allocator_ = common::Arena::Create(mesh::MeshDocument::kArenaRegionSize);
-  result_    = loadFile(filepath);
+  if (mode == mesh::MeshLoadMode::kSnapshot) {
+    result_ = common::Result{common::Status::kInvalidArguments, "expected a single snapshot target"};
+    return;
+  }
+
+  // Resolve the document(s) to load, in the order they're merged
+  auto pending = std::vector<MeshSource>{};
+  for (const auto &[filepath, type] : {
+         std::pair{  sources.descriptors,    mesh::MeshType::kDescriptorRecord},
+         std::pair{   sources.qualifiers,     mesh::MeshType::kQualifierRecord},
+         std::pair{sources.supplementals, mesh::MeshType::kSupplementalRecord},
+  }) {
+    if (filepath == nullptr) {
+      continue;
+    }
+
+    auto &source    = pending.emplace_back();
+    source.filepath = filepath;
+    source.set      = mesh::FindRecordSet(type);
+  }
+
+  if (pending.empty()) {
+    result_ = common::Result{common::Status::kInvalidArguments, "expected at least one MeSH XML document"};
+    return;
+  }
+
+  // Load each document concurrently, splitting the worker budget across them
+  const auto workers = threads > 0 ? threads : std::max(std::thread::hardware_concurrency(), 1U);
+
+  auto filepaths = std::vector<const char *>{};
+  for (const auto &source : pending) {
+    filepaths.emplace_back(source.filepath);
+  }
+
+  const auto shares  = splitWorkers(workers, filepaths);
+  auto       results = std::vector<common::Result>(pending.size());
+  auto       load    = [&](size_t index) {
+    auto &source = pending[index];
+    source.arenas.emplace_back(common::Arena::Create(kArenaRegionSize));
+
+    // Compressed documents, FIFOs & stdin can only be read sequentially
+    const auto source_mode = common::InputStream::IsMappable(source.filepath) ? mode : mesh::MeshLoadMode::kStreaming;
+    switch (source_mode) {
+    case mesh::MeshLoadMode::kStreaming:
+      results[index] = streamFile(source);
+      break;
+    case mesh::MeshLoadMode::kMapped:
+      results[index] = mapFile(source);
+      break;
+    case mesh::MeshLoadMode::kParallel:
+      results[index] = mapFile(source, shares[index]);
+      break;
+    case mesh::MeshLoadMode::kDocument:
+    default:
+      results[index] = loadFile(source);
+      break;
+    }
+  };
+
+  auto pool = std::vector<std::thread>{};
+  pool.reserve(pending.size() - 1);
+  for (size_t index = 1; index < pending.size(); ++index) {
+    pool.emplace_back(load, index);
+  }
+
+  load(0);
+  for (auto &thread : pool) {
+    thread.join();
+  }
+
+  const auto failed = std::find_if(results.begin(), results.end(), [](const common::Result &res) {
+    return !res.Ok();
+  });
+
+  if (failed != results.end()) {
+    result_ = *failed;
+    return;
+  }
+
+  // Merge in order, taking ownership of each document's text
+  //   - the mapping is retained first such that `insertRecord()` doesn't account for the text it views
+  for (auto &source : pending) {
+    if (source.mapping != nullptr) {
+      mappings_.emplace_back(std::move(source.mapping));
+    }
+
+    for (const auto &record : source.records) {
+      insertRecord(record);
+    }
+
+    for (auto &arena : source.arenas) {
+      sourceAllocators_.emplace_back(std::move(arena));
+    }
+
+    source.records = std::vector<mesh::MeshRecord>{};
+  }
+
+  // Reclaim the space left behind by relocated record group(s)
+  records_.Compact();
+  treeNumbers_.Compact();
+
+  result_ = common::Result{common::Status::kSuccessful};
+  store_      = mesh::MeshStore::Build(records_, treeNumbers_);
+  dictionary_ = mesh::MeshDictionary::Build(store_);
 };
 
-auto mesh::MeshDocument::Load(const char *filepath) -> std::shared_ptr<mesh::MeshDocument> {
-  return std::shared_ptr<mesh::MeshDocument>(new mesh::MeshDocument(filepath));
+mesh::MeshDocument::MeshDocument(const char *filepath, bool verify) : mode_(mesh::MeshLoadMode::kSnapshot) {
+  allocator_ = common::Arena::Create(mesh::MeshDocument::kArenaRegionSize);
+  result_    = mapSnapshot(filepath, verify);
+}
+
+auto mesh::MeshDocument::Load(const char        *filepath,
+                              mesh::MeshLoadMode mode /*= mesh::MeshLoadMode::kDocument*/,
+                              uint32_t           threads /*= 0*/) -> std::shared_ptr<mesh::MeshDocument> {
+  if (mode == mesh::MeshLoadMode::kSnapshot) {
+    return LoadSnapshot(filepath);
+  }
+
+  return Load(mesh::MeshSources{.descriptors = filepath}, mode, threads);
+}
+
+auto mesh::MeshDocument::Load(const mesh::MeshSources &sources,
+                              mesh::MeshLoadMode       mode /*= mesh::MeshLoadMode::kParallel*/,
+                              uint32_t                 threads /*= 0*/) -> std::shared_ptr<mesh::MeshDocument> {
+  return std::shared_ptr<mesh::MeshDocument>(new mesh::MeshDocument(sources, mode, threads));
+}
+
+auto mesh::MeshDocument::LoadSnapshot(const char *filepath,
+                                      bool        verify /*= true*/) -> std::shared_ptr<mesh::MeshDocument> {
+  return std::shared_ptr<mesh::MeshDocument>(new mesh::MeshDocument(filepath, verify));
 }
 
 auto mesh::MeshDocument::Ok() const -> bool {
@@ -187,46 +537,791 @@ auto mesh::MeshDocument::GetRecords() -> mesh::MeshRecords & {
   return records_;
 }
 
+auto mesh::MeshDocument::GetStore() const -> const mesh::MeshStore & {
+  return store_;
+}
+
+auto mesh::MeshDocument::WriteSnapshot(const char *filepath) const -> common::Result {
+  if (!result_.Ok()) {
+    return common::Result{common::Status::kInvalidArguments, "cannot snapshot a document that failed to load"};
+  }
+
+  auto handle = common::ScopedDeleter(std::fopen(filepath, "wb"), [](std::FILE *file) {
+    std::fclose(file);
+  });
+
+  if (handle.GetResource() == nullptr) {
+    return common::Result{common::Status::kFileWriteErr, "failed to open snapshot for writing"};
+  }
+
+  // The store doesn't describe any pending update until it's rebuilt, i.e. snapshot a store built from the records
+  if (HasPendingUpdates()) {
+    return mesh::MeshStore::Build(records_, treeNumbers_).Write(handle.GetResource());
+  }
+
+  return store_.Write(handle.GetResource());
+}
+
+auto mesh::MeshDocument::ApplyUpdate(const char                       *filepath,
+                                     std::span<const std::string_view> deletions /*= {}*/) -> common::Result {
+  if (!result_.Ok()) {
+    return common::Result{common::Status::kInvalidArguments, "cannot update a document that failed to load"};
+  }
+
+  if (mode_ == mesh::MeshLoadMode::kSnapshot) {
+    return common::Result{common::Status::kInvalidArguments, "cannot update a document loaded from a snapshot"};
+  }
+
+  // Read the delta, its text is allocated by this instance's arena
+  //   - `batches` describes the offset of each `<DescriptorRecord />` element's record(s) within `delta`
+  auto delta   = std::vector<mesh::MeshRecord>{};
+  auto batches = std::vector<size_t>{};
+  if (filepath != nullptr) {
+    const auto &set = *mesh::FindRecordSet(mesh::MeshType::kDescriptorRecord);
+    auto        res = streamRecords(filepath, set, *allocator_, [&](std::vector<mesh::MeshRecord> &batch) {
+      batches.emplace_back(delta.size());
+      delta.insert(delta.end(), batch.begin(), batch.end());
+      return common::Result{common::Status::kSuccessful};
+    });
+
+    if (!res) {
+      return res;
+    }
+  }
+  batches.emplace_back(delta.size());
+
+  // Resolve the descriptor(s) being replaced or deleted before modifying anything
+  auto removals = std::vector<mesh::MeshUid>{};
+  removals.reserve(batches.size() - 1 + deletions.size());
+  for (size_t index = 0; index + 1 < batches.size(); ++index) {
+    removals.emplace_back(delta[batches[index]].uid);
+  }
+
+  for (const auto &ident : deletions) {
+    const auto uid = mesh::MeshUid::FromString(ident);
+    if (!uid.Valid()) {
+      return common::Result{common::Status::kInvalidDataTypeErr, "invalid MeSH UID"};
+    }
+    removals.emplace_back(uid);
+  }
+
+  for (const auto &uid : removals) {
+    removeDescriptor(uid);
+  }
+
+  // Insert the delta; if a descriptor is described more than once then its last element takes precedence
+  auto latest = common::FlatMultiMap<mesh::MeshUid, size_t, mesh::MeshUidHash>{};
+  for (size_t index = 0; index + 1 < batches.size(); ++index) {
+    latest.Insert(delta[batches[index]].uid, index);
+  }
+
+  for (size_t index = 0; index + 1 < batches.size(); ++index) {
+    if (latest.Find(delta[batches[index]].uid).back() != index) {
+      continue;
+    }
+
+    for (auto offset = batches[index]; offset < batches[index + 1]; ++offset) {
+      const auto &record = delta[offset];
+      insertRecord(record);
+
+      if (record.type != mesh::MeshType::kTreeNumber) {
+        touch(record.uid);
+        if (record.parentUid.Valid()) {
+          pendingChildren_.Insert(record.parentUid, record.uid);
+        }
+      }
+    }
+  }
+
+  // Amortise the rebuild of the index(es) across the update(s)
+  if (pendingUids_.KeyCount() * kMaxPendingRatio > store_.Size()) {
+    Rebuild();
+  }
+
+  // Reclaim the text of replaced record(s) once it outweighs the live text
+  if (retiredBytes_ > liveBytes_ * kMaxRetiredRatio) {
+    return reclaimText();
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::Rebuild() -> void {
+  if (!result_.Ok() || !HasPendingUpdates()) {
+    return;
+  }
+
+  records_.Compact();
+  treeNumbers_.Compact();
+
+  // Release the previous index(es) before rebuilding them such that only one store is held at a time
+  dictionary_ = mesh::MeshDictionary{};
+  store_      = mesh::MeshStore{};
+  store_      = mesh::MeshStore::Build(records_, treeNumbers_);
+  dictionary_ = mesh::MeshDictionary::Build(store_);
+
+  pendingUids_     = common::FlatMultiMap<mesh::MeshUid, bool, mesh::MeshUidHash>{};
+  pendingChildren_ = mesh::MeshDocument::MeshChildMap{};
+}
+
+auto mesh::MeshDocument::HasPendingUpdates() const -> bool {
+  return !pendingUids_.Empty();
+}
+
 auto mesh::MeshDocument::HasIdentifier(std::string_view ident) -> bool {
+  const auto uid = mesh::MeshUid::FromString(ident);
+  if (!uid.Valid() && !ident.empty()) {
+    return false;
+  }
+
+  return HasIdentifier(uid);
+}
+
+auto mesh::MeshDocument::HasIdentifier(mesh::MeshUid ident) -> bool {
   if (!result_.Ok()) {
     return false;
   }
 
-  return records_.find(ident) != records_.end();
+  // The store doesn't describe the UID(s) touched by a pending update
+  if (pendingUids_.Contains(ident)) {
+    return records_.Contains(ident);
+  }
+
+  return store_.Find(ident) != mesh::MeshStore::kNullRow;
 }
 
-auto mesh::MeshDocument::loadFile(const char *filepath) -> common::Result {
-  if (!std::filesystem::exists(filepath)) {
+auto mesh::MeshDocument::HasIdentifiers(std::span<const mesh::MeshUid> idents, std::span<bool> out) const -> void {
+  const auto count = std::min(idents.size(), out.size());
+  if (!result_.Ok()) {
+    std::fill_n(out.begin(), count, false);
+    return;
+  }
+
+  auto rows = std::array<uint32_t, kProbeBatchSize>{};
+  for (size_t offset = 0; offset < count; offset += kProbeBatchSize) {
+    const auto length = std::min(kProbeBatchSize, count - offset);
+    store_.FindAll(idents.subspan(offset, length), std::span{rows.data(), length});
+    for (size_t index = 0; index < length; ++index) {
+      out[offset + index] = rows[index] != mesh::MeshStore::kNullRow;
+    }
+  }
+
+  if (!HasPendingUpdates()) {
+    return;
+  }
+
+  // The store doesn't describe the UID(s) touched by a pending update
+  for (size_t index = 0; index < count; ++index) {
+    if (pendingUids_.Contains(idents[index])) {
+      out[index] = records_.Contains(idents[index]);
+    }
+  }
+}
+
+auto mesh::MeshDocument::IsDescendantOf(std::string_view ident, std::string_view ancestor) const -> bool {
+  if (!result_.Ok()) {
+    return false;
+  }
+
+  const auto uid = mesh::MeshUid::FromString(ident);
+  const auto anc = mesh::MeshUid::FromString(ancestor);
+  if (!uid.Valid() || !anc.Valid()) {
+    return false;
+  }
+
+  return store_.IsDescendantOf(store_.Find(uid), store_.Find(anc));
+}
+
+auto mesh::MeshDocument::IsUnderTreeNumber(std::string_view ident, std::string_view treeNumber) const -> bool {
+  if (!result_.Ok()) {
+    return false;
+  }
+
+  const auto uid = mesh::MeshUid::FromString(ident);
+  if (!uid.Valid()) {
+    return false;
+  }
+
+  return store_.IsUnderTree(store_.Find(uid), store_.FindTreeNumber(treeNumber));
+}
+
+auto mesh::MeshDocument::LookupTerm(std::string_view text) const -> std::span<const mesh::MeshUid> {
+  if (!result_.Ok()) {
+    return {};
+  }
+
+  return dictionary_.Find(text);
+}
+
+auto mesh::MeshDocument::LookupTerms(std::span<const std::string_view>         texts,
+                                     std::span<std::span<const mesh::MeshUid>> out) const -> void {
+  if (!result_.Ok()) {
+    std::fill(out.begin(), out.end(), std::span<const mesh::MeshUid>{});
+    return;
+  }
+
+  dictionary_.FindAll(texts, out);
+}
+
+auto mesh::MeshDocument::Complete(std::string_view prefix,
+                                  size_t           limit /*= 10*/) const -> std::vector<mesh::MeshUid> {
+  auto uids = std::vector<mesh::MeshUid>{};
+  if (!result_.Ok()) {
+    return uids;
+  }
+
+  auto rows = std::vector<uint32_t>{};
+  rows.reserve(limit);
+  store_.CompletePrefix(prefix, limit, rows);
+
+  uids.reserve(rows.size());
+  for (const auto row : rows) {
+    uids.emplace_back(store_.Uid(row));
+  }
+
+  return uids;
+}
+
+auto mesh::MeshDocument::loadFile(mesh::MeshDocument::MeshSource &source) -> common::Result {
+  if (!std::filesystem::exists(source.filepath)) {
     return common::Result{common::Status::kFileNotFoundErr};
   }
 
   auto doc    = std::make_unique<pugi::xml_document>();
-  auto result = doc->load_file(filepath);
+  auto result = doc->load_file(source.filepath);
   if (!result) {
     return common::Result{common::Status::kXmlReadErr, result.description()};
   }
 
-  auto root = doc->child(mesh::kRecordSetNode);
+  auto root = doc->child(source.set->setNode);
   if (!root) {
     return common::Result{common::Status::kRootDoesNotExistErr};
   }
 
   auto children = root.children();
   for (const auto &node : children) {
-    if (std::strcmp(node.name(), mesh::kRecordNode) != 0) {
+    if (std::strcmp(node.name(), source.set->recordNode) != 0) {
       continue;
     }
 
-    auto res = parseRecords(static_cast<const void *>(&node));
+    auto res = parseRecords(static_cast<const void *>(&node), *source.arenas.front(), source.records);
+    if (!res) {
+      return res;
+    }
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::streamFile(mesh::MeshDocument::MeshSource &source) -> common::Result {
+  return streamRecords(source.filepath, *source.set, *source.arenas.front(), [&](std::vector<mesh::MeshRecord> &batch) {
+    source.records.insert(source.records.end(), batch.begin(), batch.end());
+    return common::Result{common::Status::kSuccessful};
+  });
+}
+
+auto mesh::MeshDocument::streamRecords(const char                *filepath,
+                                       const mesh::MeshRecordSet &set,
+                                       common::Arena             &arena,
+                                       const RecordSink          &sink) -> common::Result {
+  const auto is_stdin = std::string_view{filepath} == common::InputStream::kStdinPath;
+  if (!is_stdin && !std::filesystem::exists(filepath)) {
+    return common::Result{common::Status::kFileNotFoundErr};
+  }
+
+  // Read & decompress the document on a separate thread, see `common::InputStream`
+  auto input = common::InputStream::Open(filepath, kStreamChunkSize);
+  if (!input.has_value()) {
+    return input.error();
+  }
+
+  const auto root_tag   = std::string{"<"} + set.setNode;
+  const auto close_tag  = std::string{"</"} + set.recordNode + ">";
+  auto       buffer     = std::string{};
+  auto       block      = std::string_view{};
+  auto       pending    = std::vector<MeshRecord>{};
+  auto       has_root   = false;
+  auto       is_eof     = false;
+  size_t     cursor     = 0;  // Offset of the first unconsumed byte within the buffer
+  size_t     scan_start = 0;  // Offset from which to resume searching for the current record's end tag
+  while (true) {
+    auto window = std::string_view{buffer};
+    if (!has_root) {
+      const auto root = window.find(root_tag);
+      if (root != std::string_view::npos) {
+        has_root = true;
+        cursor   = root + root_tag.size();
+      }
+    }
+
+    // Consume every complete record within the window
+    while (has_root) {
+      const auto start = findRecordStart(window, cursor, set);
+      if (start == std::string_view::npos) {
+        break;
+      }
+
+      const auto end = window.find(close_tag, std::max(start, scan_start));
+      if (end == std::string_view::npos) {
+        cursor     = start;
+        scan_start = std::max(start, window.size() > close_tag.size() ? window.size() - close_tag.size() : 0);
+        break;
+      }
+
+      auto res = parseStreamRecord(window.substr(start, end + close_tag.size() - start), set, false, arena, pending);
+      if (!res) {
+        return res;
+      }
+
+      res = sink(pending);
+      if (!res) {
+        return res;
+      }
+      pending.clear();
+
+      cursor     = end + close_tag.size();
+      scan_start = cursor;
+    }
+
+    if (is_eof) {
+      break;
+    }
+
+    // Discard the consumed bytes & refill the window
+    if (has_root) {
+      buffer.erase(0, cursor);
+      scan_start -= std::min(scan_start, cursor);
+      cursor      = 0;
+    } else if (buffer.size() > root_tag.size()) {
+      buffer.erase(0, buffer.size() - root_tag.size());
+    }
+
+    if (!input.value()->Next(block)) {
+      auto res = input.value()->GetResult();
+      if (!res) {
+        return common::Result{common::Status::kXmlReadErr, res.Description()};
+      }
+
+      is_eof = true;
+      continue;
+    }
+    buffer.append(block);
+  }
+
+  if (!has_root) {
+    return common::Result{common::Status::kRootDoesNotExistErr};
+  }
+
+  if (findRecordStart(buffer, cursor, set) != std::string_view::npos) {
+    return common::Result{common::Status::kXmlReadErr, "unexpected end of document"};
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::mapFile(mesh::MeshDocument::MeshSource &source, uint32_t threads /*= 1*/) -> common::Result {
+  if (!std::filesystem::exists(source.filepath)) {
+    return common::Result{common::Status::kFileNotFoundErr};
+  }
+
+  auto mapping = common::MappedFile::Create(source.filepath);
+  if (!mapping.has_value()) {
+    return mapping.error();
+  }
+  source.mapping = std::move(mapping.value());
+
+  const auto &set      = *source.set;
+  const auto  root_tag = std::string{"<"} + set.setNode;
+  auto        window   = source.mapping->View();
+  auto        root     = window.find(root_tag);
+  if (root == std::string_view::npos) {
+    return common::Result{common::Status::kRootDoesNotExistErr};
+  }
+  window.remove_prefix(root + root_tag.size());
+
+  // Split the document into ranges aligned to the beginning of a record
+  const auto workers = std::max<size_t>(1, std::min<size_t>(threads, window.size() / kParallelChunkSize + 1));
+
+  auto bounds = std::vector<size_t>{0};
+  for (size_t index = 1; index < workers; ++index) {
+    const auto offset = findRecordStart(window, std::max(bounds.back(), index * (window.size() / workers)), set);
+    if (offset == std::string_view::npos) {
+      break;
+    }
+
+    if (offset > bounds.back()) {
+      bounds.emplace_back(offset);
+    }
+  }
+  bounds.emplace_back(window.size());
+
+  // Parse each range into its own arena
+  const auto ranges  = bounds.size() - 1;
+  auto       results = std::vector<common::Result>(ranges);
+  auto       outputs = std::vector<std::vector<MeshRecord>>(ranges);
+  while (source.arenas.size() < ranges) {
+    source.arenas.emplace_back(common::Arena::Create(kArenaRegionSize));
+  }
+
+  auto work = [&](size_t index) {
+    const auto range = window.substr(bounds[index], bounds[index + 1] - bounds[index]);
+    results[index]   = parseRange(range, set, *source.arenas[index], outputs[index]);
+  };
+
+  if (ranges > 1) {
+    auto pool = std::vector<std::thread>{};
+    pool.reserve(ranges - 1);
+    for (size_t index = 1; index < ranges; ++index) {
+      pool.emplace_back(work, index);
+    }
+
+    work(0);
+    for (auto &thread : pool) {
+      thread.join();
+    }
+  } else {
+    work(0);
+  }
+
+  // Merge in document order
+  for (size_t index = 0; index < ranges; ++index) {
+    if (!results[index]) {
+      return results[index];
+    }
+
+    source.records.insert(source.records.end(), outputs[index].begin(), outputs[index].end());
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::mapSnapshot(const char *filepath, bool verify) -> common::Result {
+  if (!std::filesystem::exists(filepath)) {
+    return common::Result{common::Status::kFileNotFoundErr};
+  }
+
+  auto mapping = common::MappedFile::Create(filepath);
+  if (!mapping.has_value()) {
+    return mapping.error();
+  }
+  const auto &view = mappings_.emplace_back(std::move(mapping.value()));
+
+  auto store = mesh::MeshStore::View(view->View(), verify);
+  if (!store.has_value()) {
+    return store.error();
+  }
+  store_      = std::move(store.value());
+  dictionary_ = mesh::MeshDictionary::Build(store_);
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::removeDescriptor(mesh::MeshUid uid) -> void {
+  const auto existing = records_.Find(uid);
+  const auto found    = std::any_of(existing.begin(), existing.end(), [](const mesh::MeshRecord &record) {
+    return record.type == mesh::MeshType::kDescriptorRecord;
+  });
+
+  if (!found) {
+    return;
+  }
+
+  const auto retire = [this](std::span<const mesh::MeshRecord> records) {
+    for (const auto &record : records) {
+      const auto size = ownedTextSize(record);
+      liveBytes_    -= size;
+      retiredBytes_ += size;
+    }
+  };
+
+  const auto owned_by = [&retire](mesh::MeshUid parent) {
+    return [&retire, parent](const mesh::MeshRecord &record) {
+      if (record.parentUid != parent) {
+        return false;
+      }
+
+      retire({&record, 1});
+      return true;
+    };
+  };
+
+  // Only the record(s) owned by this descriptor are removed, e.g. a qualifier is shared by many descriptors
+  forEachChild(uid, [&](mesh::MeshUid child_uid) {
+    const auto children = records_.Find(child_uid);
+    if (children.empty()) {
+      return;
+    }
+
+    const auto is_concept = children.front().type == mesh::MeshType::kConcept;
+    records_.EraseIf(child_uid, owned_by(uid));
+    touch(child_uid);
+
+    if (!is_concept || records_.Contains(child_uid)) {
+      return;
+    }
+
+    forEachChild(child_uid, [&](mesh::MeshUid term_uid) {
+      records_.EraseIf(term_uid, owned_by(child_uid));
+      touch(term_uid);
+    });
+  });
+
+  retire(records_.Find(uid));
+  retire(treeNumbers_.Find(uid));
+  records_.Erase(uid);
+  treeNumbers_.Erase(uid);
+  touch(uid);
+}
+
+template <typename Func>
+auto mesh::MeshDocument::forEachChild(mesh::MeshUid uid, Func &&func) const -> void {
+  const auto row = store_.Find(uid);
+  if (row != mesh::MeshStore::kNullRow) {
+    for (const auto child : store_.Children(row)) {
+      func(store_.Uid(child));
+    }
+  }
+
+  for (const auto child : pendingChildren_.Find(uid)) {
+    func(child);
+  }
+}
+
+auto mesh::MeshDocument::touch(mesh::MeshUid uid) -> void {
+  if (!pendingUids_.Contains(uid)) {
+    pendingUids_.Insert(uid, true);
+  }
+}
+
+auto mesh::MeshDocument::reclaimText() -> common::Result {
+  auto arena = common::Arena::Create(kArenaRegionSize);
+
+  // Copy each map, relocating any arena-owned text
+  auto relocate = [this, &arena](const mesh::MeshRecords &input, mesh::MeshRecords &output) -> common::Result {
+    output.Reserve(input.KeyCount(), input.Size());
+    for (const auto &[key, record] : input) {
+      auto copy = record;
+      if (ownedTextSize(record) > 0) {
+        auto text = std::string_view{};
+        auto res  = allocText(*arena, text, record.Name());
+        if (!res) {
+          return res;
+        }
+
+        copy.name = text.data();
+      }
+
+      output.Insert(key, copy);
+    }
+
+    return common::Result{common::Status::kSuccessful};
+  };
+
+  auto records = mesh::MeshRecords{};
+  auto trees   = mesh::MeshRecords{};
+  auto res     = relocate(records_, records);
+  if (res) {
+    res = relocate(treeNumbers_, trees);
+  }
+
+  if (!res) {
+    return res;
+  }
+
+  records_      = std::move(records);
+  treeNumbers_  = std::move(trees);
+  allocator_    = std::move(arena);
+  retiredBytes_ = 0;
+  sourceAllocators_.clear();
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::ownedTextSize(const mesh::MeshRecord &record) const -> size_t {
+  if (record.name == nullptr) {
+    return 0;
+  }
+
+  const auto mapped = std::any_of(mappings_.begin(), mappings_.end(), [&record](const auto &mapping) {
+    const auto view = mapping->View();
+    return record.name >= view.data() && record.name < view.data() + view.size();
+  });
+
+  return mapped ? 0 : record.nameLen + 1;
+}
+
+auto mesh::MeshDocument::insertRecord(const mesh::MeshRecord &record) -> void {
+  liveBytes_ += ownedTextSize(record);
+  if (record.type == mesh::MeshType::kTreeNumber) {
+    treeNumbers_.Insert(record.parentUid, record);
+    return;
+  }
+
+  records_.Insert(record.uid, record);
+}
+
+auto mesh::MeshDocument::parseRange(std::string_view               range,
+                                    const mesh::MeshRecordSet     &set,
+                                    common::Arena                 &arena,
+                                    std::vector<mesh::MeshRecord> &out) -> common::Result {
+  const auto close_tag = std::string{"</"} + set.recordNode + ">";
+
+  size_t cursor{0};
+  while (true) {
+    const auto start = findRecordStart(range, cursor, set);
+    if (start == std::string_view::npos) {
+      break;
+    }
+
+    const auto end = range.find(close_tag, start);
+    if (end == std::string_view::npos) {
+      return common::Result{common::Status::kXmlReadErr, "unexpected end of document"};
+    }
+
+    auto res = parseStreamRecord(range.substr(start, end + close_tag.size() - start), set, true, arena, out);
     if (!res) {
       return res;
     }
+
+    cursor = end + close_tag.size();
   }
 
   return common::Result{common::Status::kSuccessful};
 }
 
-auto mesh::MeshDocument::parseRecords(const void *nodePtr, const char *parentUid /*= nullptr*/) -> common::Result {
+auto mesh::MeshDocument::parseStreamRecord(std::string_view               source,
+                                           const mesh::MeshRecordSet     &set,
+                                           bool                           isMapped,
+                                           common::Arena                 &arena,
+                                           std::vector<mesh::MeshRecord> &out) -> common::Result {
+  auto frames  = std::vector<StreamFrame>{};
+  auto records = std::vector<PendingRecord>{};
+  frames.reserve(16);
+  records.reserve(32);
+
+  auto reader = mesh::XmlReader{source};
+  auto token  = mesh::XmlToken::kEnd;
+  while ((token = reader.Next()) != mesh::XmlToken::kEnd) {
+    switch (token) {
+    case mesh::XmlToken::kStartElement: {
+      const auto name  = reader.Name();
+      const auto type  = tryGetStreamType(frames, records, set, name);
+      auto       frame = StreamFrame{.name = name, .record = -1};
+      if (type != mesh::MeshType::kUnknown) {
+        auto parent = int32_t{-1};
+        for (auto index = frames.size(); index > 0; --index) {
+          if (frames[index - 1].record >= 0) {
+            parent = frames[index - 1].record;
+            break;
+          }
+        }
+
+        auto record = PendingRecord{
+          .uid     = std::string_view{},
+          .name    = std::string_view{},
+          .rawName = false,
+          .type    = type,
+          .cat     = mesh::MeshCategory::kUnknown,
+          .mod     = mesh::MeshModifier::kUnknown,
+          .depth   = static_cast<uint32_t>(frames.size()),
+          .parent  = parent,
+          .code    = mesh::MeshUid{},
+        };
+
+        auto res = tryGetStreamAttributes(reader, record);
+        if (!res) {
+          return res;
+        }
+
+        frame.record = static_cast<int32_t>(records.size());
+        records.emplace_back(record);
+      } else if (frames.empty()) {
+        return common::Result{common::Status::kUnknownNodeTypeErr};
+      }
+
+      frames.emplace_back(frame);
+    } break;
+
+    case mesh::XmlToken::kEndElement:
+      if (frames.empty() || frames.back().name != reader.Name()) {
+        return common::Result{common::Status::kXmlReadErr, "mismatched end element"};
+      }
+      frames.pop_back();
+      break;
+
+    case mesh::XmlToken::kText: {
+      const auto text = reader.Text();
+      if (!frames.empty() && (reader.IsRawText() || !isWhitespace(text))) {
+        assignStreamText(frames, records, text, reader.IsRawText());
+      }
+    } break;
+
+    case mesh::XmlToken::kError:
+      return common::Result{common::Status::kXmlReadErr, "malformed record element"};
+
+    default:
+      break;
+    }
+  }
+
+  if (!frames.empty() || records.empty()) {
+    return common::Result{common::Status::kXmlReadErr, "incomplete record element"};
+  }
+
+  // Commit in the same order as `parseRecords()`, i.e. the descriptor, its concept(s) & their terms, then
+  // any allowable qualifier(s)
+  //   - text is referenced in place if the source outlives this instance & it doesn't need decoding
+  auto intern = [&](std::string_view &dst, std::string_view text, bool isRaw) -> common::Result {
+    if (isMapped && (isRaw || !mesh::HasEntities(text))) {
+      dst = text;
+      return common::Result{common::Status::kSuccessful};
+    }
+
+    return allocText(arena, dst, text, !isRaw);
+  };
+
+  auto commit = [&](PendingRecord &record) -> common::Result {
+    const auto uid = mesh::MeshUid::FromString(record.uid);
+    if (!uid.Valid() && !record.uid.empty()) {
+      return common::Result{common::Status::kInvalidDataTypeErr, "invalid MeSH UID"};
+    }
+
+    auto name = std::string_view{};
+    auto res  = intern(name, record.name, record.rawName);
+    if (!res) {
+      return res;
+    }
+
+    const auto parent = record.parent >= 0 ? records[record.parent].code : mesh::MeshUid{};
+    out.emplace_back(packRecord(uid, name, parent, record.type, record.cat, record.mod));
+    record.code = uid;
+    return res;
+  };
+
+  auto res = commit(records.front());
+  if (!res) {
+    return res;
+  }
+
+  for (auto pass : {false, true}) {
+    for (auto iter = records.begin() + 1; iter != records.end(); ++iter) {
+      if ((iter->type == mesh::MeshType::kQualifier) != pass) {
+        continue;
+      }
+
+      res = commit(*iter);
+      if (!res) {
+        return res;
+      }
+    }
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshDocument::parseRecords(const void                    *nodePtr,
+                                      common::Arena                 &arena,
+                                      std::vector<mesh::MeshRecord> &out,
+                                      mesh::MeshUid                  parentUid /*= {}*/) -> common::Result {
   if (nodePtr == nullptr) {
     return common::Result{common::Status::kNodeDoesNotExistErr};
   }
@@ -256,6 +1351,11 @@ auto mesh::MeshDocument::parseRecords(const void *nodePtr, const char *parentUid
     return common::Result{common::Status::kInvalidDataTypeErr};
   }
 
+  const auto code = mesh::MeshUid::FromString(uid);
+  if (!code.Valid() && uid[0] != '\0') {
+    return common::Result{common::Status::kInvalidDataTypeErr, "invalid MeSH UID"};
+  }
+
   switch (type) {
   case mesh::MeshType::kDescriptorRecord: {
     const auto cat_result = tryGetDescriptorClass(node->attribute(mesh::kDescClassAttr).value());
@@ -284,21 +1384,32 @@ auto mesh::MeshDocument::parseRecords(const void *nodePtr, const char *parentUid
     mod = attr->mod;
   } break;
 
+  case mesh::MeshType::kSupplementalRecord: {
+    const auto cat_result = tryGetSupplementalClass(node->attribute(mesh::kSuppClassAttr).value());
+    if (!cat_result.has_value()) {
+      return cat_result.error();
+    }
+    cat = cat_result.value();
+  } break;
+
   case mesh::MeshType::kQualifier:
+  case mesh::MeshType::kQualifierRecord:
     break;
 
   default:
     return common::Result{common::Status::kUnknownNodeTypeErr};
   };
 
-  auto rec = mesh::MeshRecord{};
-  auto res = allocRecord(rec, uid, name, parentUid, type, cat, mod);
+  auto name_buf = std::string_view{};
+  auto res      = allocText(arena, name_buf, name);
   if (!res) {
     return res;
   }
 
-  if (type == mesh::MeshType::kDescriptorRecord || type == mesh::MeshType::kConcept) {
-    res = iterateChildren(nodePtr, type, rec.buf);
+  out.emplace_back(packRecord(code, name_buf, parentUid, type, cat, mod));
+
+  if (type != mesh::MeshType::kTerm && type != mesh::MeshType::kQualifier) {
+    res = iterateChildren(nodePtr, type, arena, out, code);
     if (!res) {
       return res;
     }
@@ -307,9 +1418,11 @@ auto mesh::MeshDocument::parseRecords(const void *nodePtr, const char *parentUid
   return common::Result{common::Status::kSuccessful};
 }
 
-auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
-                                         const mesh::MeshType &type,
-                                         const char           *parentUid) -> common::Result {
+auto mesh::MeshDocument::iterateChildren(const void                    *nodePtr,
+                                         const mesh::MeshType          &type,
+                                         common::Arena                 &arena,
+                                         std::vector<mesh::MeshRecord> &out,
+                                         mesh::MeshUid                  parentUid) -> common::Result {
   if (nodePtr == nullptr) {
     return common::Result{common::Status::kSuccessful};
   }
@@ -329,7 +1442,7 @@ auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
           continue;
         }
 
-        auto res = parseRecords(static_cast<const void *>(&child), parentUid);
+        auto res = parseRecords(static_cast<const void *>(&child), arena, out, parentUid);
         if (!res) {
           return res;
         }
@@ -338,7 +1451,31 @@ auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
     result.SetStatus(common::Status::kSuccessful);
   } break;
 
-  case mesh::MeshType::kDescriptorRecord: {
+  case mesh::MeshType::kDescriptorRecord:
+  case mesh::MeshType::kSupplementalRecord:
+  case mesh::MeshType::kQualifierRecord: {
+    auto trees = node->child(mesh::kTreeListNode);
+    if (trees) {
+      for (const auto &child : trees.children()) {
+        if (std::strcmp(child.name(), mesh::kTreeNode) != 0) {
+          continue;
+        }
+
+        auto name = std::string_view{};
+        auto res  = allocText(arena, name, child.child_value());
+        if (!res) {
+          return res;
+        }
+
+        out.emplace_back(packRecord(mesh::MeshUid{},
+                                    name,
+                                    parentUid,
+                                    mesh::MeshType::kTreeNumber,
+                                    mesh::MeshCategory::kUnknown,
+                                    mesh::MeshModifier::kUnknown));
+      }
+    }
+
     auto concepts = node->child(mesh::kConcListNode);
     if (concepts) {
       for (const auto &child : concepts.children()) {
@@ -346,7 +1483,7 @@ auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
           continue;
         }
 
-        auto res = parseRecords(static_cast<const void *>(&child), parentUid);
+        auto res = parseRecords(static_cast<const void *>(&child), arena, out, parentUid);
         if (!res) {
           return res;
         }
@@ -360,7 +1497,7 @@ auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
           continue;
         }
 
-        auto res = parseRecords(static_cast<const void *>(&child), parentUid);
+        auto res = parseRecords(static_cast<const void *>(&child), arena, out, parentUid);
         if (!res) {
           return res;
         }
@@ -376,30 +1513,36 @@ auto mesh::MeshDocument::iterateChildren(const void           *nodePtr,
   return result;
 }
 
-auto mesh::MeshDocument::allocRecord(mesh::MeshRecord  &out,
-                                     const char        *uid,
-                                     const char        *name,
-                                     const char        *parentUid,
-                                     mesh::MeshType     type,
-                                     mesh::MeshCategory cat /*= mesh::MeshCategory::kUnknown*/,
-                                     mesh::MeshModifier mod /*= mesh::MeshModifier::kUnknown*/) -> common::Result {
-  out.buf       = nullptr;
-  out.parentUid = parentUid;
-  out.uidLen    = static_cast<uint16_t>(std::strlen(uid));
-  out.nameLen   = static_cast<uint16_t>(std::strlen(name));
-  out.type      = type;
-  out.category  = cat;
-  out.modifier  = mod;
-
+auto mesh::MeshDocument::allocText(common::Arena    &arena,
+                                   std::string_view &out,
+                                   std::string_view  text,
+                                   bool              decode /*= false*/) -> common::Result {
   uint8_t *ptr{nullptr};
-  if (!allocator_->Allocate(static_cast<int64_t>(out.uidLen + out.nameLen + 2), &ptr)) {
+  if (!arena.Allocate(static_cast<int64_t>(text.size() + 1), &ptr)) {
     return common::Result{common::Status::kAllocationErr};
   }
 
-  std::memcpy(ptr, uid, out.uidLen + 1);
-  std::memcpy(ptr + out.uidLen + 1, name, out.nameLen + 1);
+  auto *buf = reinterpret_cast<char *>(ptr);
+  auto  len = decode ? mesh::DecodeText(text, buf) : text.copy(buf, text.size());
+  buf[len]  = '\0';
 
-  out.buf = reinterpret_cast<char *>(ptr);
-  records_.emplace(out.buf, out);
+  out = std::string_view{buf, len};
   return common::Result{common::Status::kSuccessful};
 }
+
+auto mesh::MeshDocument::packRecord(mesh::MeshUid      uid,
+                                    std::string_view   name,
+                                    mesh::MeshUid      parentUid,
+                                    mesh::MeshType     type,
+                                    mesh::MeshCategory cat,
+                                    mesh::MeshModifier mod) -> mesh::MeshRecord {
+  return mesh::MeshRecord{
+    .name      = name.data(),
+    .uid       = uid,
+    .parentUid = parentUid,
+    .nameLen   = static_cast<uint16_t>(name.size()),
+    .type      = type,
+    .category  = cat,
+    .modifier  = mod,
+  };
+}
@@ -1,19 +1,22 @@
 #pragma once
 
 #include "termspp/common/arena.hpp"
+#include "termspp/common/flatmap.hpp"
+#include "termspp/common/mapped.hpp"
 #include "termspp/common/result.hpp"
 #include "termspp/mesh/defs.hpp"
+#include "termspp/mesh/dictionary.hpp"
+#include "termspp/mesh/store.hpp"
 
-#include <map>
+#include <functional>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace termspp {
 namespace mesh {
 
-/// Uid reference map type
-typedef std::multimap<std::string_view, MeshRecord> MeshRecords;
-
 // /// Uid reference map type
 // typedef std::unordered_map<const char *, MeshRecord, common::CharHash, common::CharComp> MeshRecords;
 
@@ -23,11 +26,57 @@ class MeshDocument final : public std::enable_shared_from_this<MeshDocument> {
   /// Arena allocator region size
   static constexpr const size_t kArenaRegionSize{4096LL};
 
+  /// Size of the chunks read from file when streaming the document
+  static constexpr const size_t kStreamChunkSize{1LL << 20};
+
+  /// Minimum size of the byte range(s) assigned to each worker when parsing the document in parallel
+  static constexpr const size_t kParallelChunkSize{1LL << 22};
+
+  /// Number of UIDs resolved together by `HasIdentifiers()`
+  static constexpr const size_t kProbeBatchSize{32U};
+
+  /// Max. ratio of the retired record text retained by this instance's arena(s) to its live record text, see
+  /// `ApplyUpdate()`
+  static constexpr const size_t kMaxRetiredRatio{1U};
+
+  /// Min. ratio of the store's rows to the UID(s) touched by pending updates, i.e. `ApplyUpdate()` rebuilds the
+  /// indexes once the pending updates touch more than 1/`kMaxPendingRatio` of the document, see `Rebuild()`
+  static constexpr const size_t kMaxPendingRatio{8U};
+
 public:
   /// Creates a new MeSH document instance by attemting to load
   /// the referenced MeSH XML file into memory and constructing a map
   /// of the MeSH unique identifiers
-  static auto Load(const char *filepath) -> std::shared_ptr<MeshDocument>;
+  ///   - `MeshLoadMode::kStreaming` can be used to bound the peak memory of the parser by the size of the
+  ///     largest `<DescriptorRecord />` rather than the size of the document
+  ///   - `MeshLoadMode::kMapped` maps the document into memory for the lifetime of this instance such that
+  ///     the records reference the mapped text rather than copying it
+  ///   - `MeshLoadMode::kParallel` behaves like `kMapped` but parses the document across `threads` workers;
+  ///     defaults to the number of hardware threads if `threads` is zero
+  ///   - gzip/zstd-compressed documents, FIFOs & stdin, i.e. `-`, can't be mapped & are always streamed, see
+  ///     `common::InputStream`
+  static auto Load(const char  *filepath,
+                   MeshLoadMode mode    = MeshLoadMode::kDocument,
+                   uint32_t     threads = 0) -> std::shared_ptr<MeshDocument>;
+
+  /// Creates a new MeSH document instance from one or more MeSH XML files, i.e. the descriptor, qualifier &
+  /// supplementary record sets
+  ///   - each file is parsed concurrently on its own thread & their records are merged into a single store in
+  ///     the order: descriptors, qualifiers, supplementals
+  ///   - the mode is applied to each file; defaults to `MeshLoadMode::kParallel` since the supplementary file
+  ///     is several times larger than the descriptor file
+  ///   - if parsed in parallel, the `threads` budget is split across the files in proportion to their size
+  ///     rather than given to each, i.e. no more than `threads` workers run at once (plus one per small file)
+  static auto Load(const MeshSources &sources,
+                   MeshLoadMode       mode    = MeshLoadMode::kParallel,
+                   uint32_t           threads = 0) -> std::shared_ptr<MeshDocument>;
+
+  /// Creates a new MeSH document instance by mapping a snapshot written by `WriteSnapshot()`
+  ///   - the document is queryable as soon as the snapshot has been mapped, its store references the mapping
+  ///     directly such that no parsing or allocation is required
+  ///   - `GetRecords()` is empty for documents loaded from a snapshot, use `GetStore()` instead
+  ///   - the snapshot's checksum is only validated if `verify` is set
+  static auto LoadSnapshot(const char *filepath, bool verify = true) -> std::shared_ptr<MeshDocument>;
 
 public:
   ~MeshDocument() = default;
@@ -55,38 +104,200 @@ public:
   /// Getter: Get records contained by this instance
   [[nodiscard]] auto GetRecords() -> MeshRecords &;
 
+  /// Getter: Get the struct-of-arrays store of this instance's records, incl. its parent/child graph
+  [[nodiscard]] auto GetStore() const -> const MeshStore &;
+
+  /// Write a versioned & checksummed binary snapshot of this document to the given path
+  auto WriteSnapshot(const char *filepath) const -> common::Result;
+
+  /// Incrementally applies a MeSH update to this document
+  ///   - `filepath` references a `<DescriptorRecordSet />` XML document describing the added & changed
+  ///     `<DescriptorRecord />` elements, e.g. NLM's interim update files; may be null if there's nothing to add
+  ///   - `deletions` describes the UID(s) of the `<DescriptorRecord />` element(s) to delete
+  ///   - a changed descriptor replaces its previous record(s), incl. its concept(s), term(s) & qualifier(s)
+  ///   - the delta is streamed into this instance's arena & its record(s) patched into the record map(s) in place,
+  ///     i.e. an update costs O(delta); `HasIdentifier()` & `HasIdentifiers()` reflect the update immediately
+  ///   - the store & dictionary are left describing the previous state until they're rebuilt, either explicitly
+  ///     by `Rebuild()` or once the pending updates touch more than 1/`kMaxPendingRatio` of the document, i.e. the
+  ///     O(document) cost of the rebuild is amortised across the updates
+  ///   - the text of any replaced record is retained by the arena(s) until it exceeds `kMaxRetiredRatio` times the
+  ///     live record text, at which point the live text is relocated to a new arena & the old arena(s) released
+  ///   - not supported by documents loaded from a snapshot
+  auto ApplyUpdate(const char *filepath, std::span<const std::string_view> deletions = {}) -> common::Result;
+
+  /// Rebuilds the store & dictionary from this instance's records if any update is pending, see `ApplyUpdate()`
+  ///   - the previous store is released before the rebuild such that only one store is held at a time
+  auto Rebuild() -> void;
+
+  /// Getter: whether any update has been applied since the store & dictionary were last built
+  [[nodiscard]] auto HasPendingUpdates() const -> bool;
+
   /// Test whether a MeSH identifier exists within this document
   [[nodiscard]] auto HasIdentifier(std::string_view ident) -> bool;
 
+  /// Test whether an encoded MeSH identifier exists within this document
+  [[nodiscard]] auto HasIdentifier(MeshUid ident) -> bool;
+
+  /// Test whether each of a batch of encoded MeSH identifiers exists within this document
+  ///   - UIDs are resolved in blocks of `kProbeBatchSize` by `MeshStore::FindAll()`, i.e. the cache misses of
+  ///     each block overlap
+  ///   - `out` is expected to be sized to at least `idents.size()`; never allocates
+  auto HasIdentifiers(std::span<const MeshUid> idents, std::span<bool> out) const -> void;
+
+  /// Test whether a MeSH descriptor is a strict descendant of another within the MeSH tree(s)
+  ///   - i.e. whether any of its `<TreeNumber />`(s) lies beneath any of the ancestor's
+  ///   - e.g. `IsDescendantOf("D012711", "D002318")`
+  [[nodiscard]] auto IsDescendantOf(std::string_view ident, std::string_view ancestor) const -> bool;
+
+  /// Test whether a MeSH descriptor lies strictly beneath the given tree number
+  ///   - e.g. `IsUnderTreeNumber("D012711", "C04")`
+  [[nodiscard]] auto IsUnderTreeNumber(std::string_view ident, std::string_view treeNumber) const -> bool;
+
+  /// Resolve free text to the UID(s) of the record(s) whose normalised name matches it exactly
+  ///   - see `MeshDictionary::Normalise()` for how text is normalised
+  ///   - the result views this document's dictionary, i.e. it's invalidated by `Rebuild()`
+  [[nodiscard]] auto LookupTerm(std::string_view text) const -> std::span<const MeshUid>;
+
+  /// Resolve a batch of free text, see `LookupTerm()`
+  ///   - `out` is expected to be sized to at least `texts.size()`; never allocates
+  auto LookupTerms(std::span<const std::string_view> texts, std::span<std::span<const MeshUid>> out) const -> void;
+
+  /// Type-ahead: find the UIDs of the best `limit` records whose name begins with the given prefix
+  ///   - see `MeshStore::CompletePrefix()` for how records are matched & ranked
+  [[nodiscard]] auto Complete(std::string_view prefix, size_t limit = 10) const -> std::vector<MeshUid>;
+
+private:
+  /// Consumes the record(s) of each record element read by `streamRecords()`
+  typedef std::function<common::Result(std::vector<MeshRecord> &)> RecordSink;
+
+  /// Parent UID->child UID(s) map
+  typedef common::FlatMultiMap<MeshUid, MeshUid, MeshUidHash> MeshChildMap;
+
+  /// Describes a MeSH XML file being loaded
+  ///   - each source is loaded independently of the others such that they can be loaded concurrently
+  struct MeshSource {
+    const char                                 *filepath;  /// Document target
+    const MeshRecordSet                        *set;       /// Document root & record elements
+    std::vector<MeshRecord>                     records;   /// Record(s) parsed from the document
+    std::vector<std::unique_ptr<common::Arena>> arenas;    /// Arena(s) owning the record text
+    std::unique_ptr<common::MappedFile>         mapping;   /// Mapped document, if any
+  };
+
 private:
   /// Loads the document from file
-  auto loadFile(const char *filepath) -> common::Result;
+  static auto loadFile(MeshSource &source) -> common::Result;
+
+  /// Streams the document from file, parsing each record element as soon as it's been read
+  static auto streamFile(MeshSource &source) -> common::Result;
+
+  /// Streams a document from file, passing the record(s) of each record element to the given sink
+  static auto streamRecords(const char          *filepath,
+                            const MeshRecordSet &set,
+                            common::Arena       &arena,
+                            const RecordSink    &sink) -> common::Result;
+
+  /// Removes a `<DescriptorRecord />` & the record(s) it owns from this instance's records
+  ///   - the size of the removed records' arena-owned text is moved from `liveBytes_` to `retiredBytes_`
+  auto removeDescriptor(MeshUid uid) -> void;
+
+  /// Iterates the UID(s) of the record(s) parented by the given UID, i.e. those described by the store & those
+  /// inserted by any pending update
+  ///   - may visit a UID more than once, or one whose record(s) have since been removed
+  template <typename Func>
+  auto forEachChild(MeshUid uid, Func &&func) const -> void;
+
+  /// Records that an update has touched the record(s) of the given UID, see `HasIdentifier()`
+  auto touch(MeshUid uid) -> void;
+
+  /// Relocates the arena-owned text of every live record to a new arena, releasing the previous arena(s)
+  ///   - text viewing a mapped document is left in place
+  auto reclaimText() -> common::Result;
+
+  /// Getter: the size of a record's text owned by this instance's arena(s), i.e. zero if it views a mapping
+  [[nodiscard]] auto ownedTextSize(const MeshRecord &record) const -> size_t;
+
+  /// Inserts a parsed record into this instance's records, or its tree numbers if it's a `<TreeNumber />`
+  ///   - the size of its arena-owned text is accumulated by `liveBytes_`
+  auto insertRecord(const MeshRecord &record) -> void;
+
+  /// Maps the document into memory & parses each record element in place
+  ///   - if more than one thread is requested, the document is split into byte ranges aligned to record
+  ///     boundaries; each worker parses its range into its own arena & the results are merged in document
+  ///     order, i.e. the output is equivalent to the serial path
+  static auto mapFile(MeshSource &source, uint32_t threads = 1) -> common::Result;
+
+  /// Maps a snapshot written by `WriteSnapshot()` & views its store in place
+  auto mapSnapshot(const char *filepath, bool verify) -> common::Result;
+
+  /// Parses every record element that begins within the given range of a mapped document
+  static auto parseRange(std::string_view         range,
+                         const MeshRecordSet     &set,
+                         common::Arena           &arena,
+                         std::vector<MeshRecord> &out) -> common::Result;
+
+  /// Parses a single, complete record element read by `streamFile()` or `mapFile()`
+  ///   - `isMapped` describes whether the source outlives this instance, i.e. whether records can reference it
+  ///   - records are appended to `out` in the same order as `parseRecords()`, their text is allocated by `arena`
+  static auto parseStreamRecord(std::string_view         source,
+                                const MeshRecordSet     &set,
+                                bool                     isMapped,
+                                common::Arena           &arena,
+                                std::vector<MeshRecord> &out) -> common::Result;
 
   /// Tandem recursive function alongside `iterateChildren()` to parse records
-  auto parseRecords(const void *nodePtr, const char *parentUid = nullptr) -> common::Result;
+  static auto parseRecords(const void              *nodePtr,
+                           common::Arena           &arena,
+                           std::vector<MeshRecord> &out,
+                           MeshUid                  parentUid = {}) -> common::Result;
 
   /// Tandem recursive function alongside `parseRecords()` to parse records
-  auto iterateChildren(const void *nodePtr, const MeshType &type, const char *parentUid) -> common::Result;
+  static auto iterateChildren(const void              *nodePtr,
+                              const MeshType          &type,
+                              common::Arena           &arena,
+                              std::vector<MeshRecord> &out,
+                              MeshUid                  parentUid) -> common::Result;
 
-  /// Allocates a record to this instance's arena and packs it into a struct
-  auto allocRecord(MeshRecord  &out,
-                   const char  *uid,
-                   const char  *name,
-                   const char  *parentUid,
-                   MeshType     type,
-                   MeshCategory cat = MeshCategory::kUnknown,
-                   MeshModifier mod = MeshModifier::kUnknown) -> common::Result;
+  /// Allocates a copy of some text to the given arena, optionally decoding its XML entity references
+  ///   - the copy is null terminated
+  static auto allocText(common::Arena    &arena,
+                        std::string_view &out,
+                        std::string_view  text,
+                        bool              decode = false) -> common::Result;
+
+  /// Packs a record into a struct
+  ///   - expects the given name to outlive this instance, i.e. it's been allocated by `allocText()` or it
+  ///     references the mapped document
+  static auto packRecord(MeshUid          uid,
+                         std::string_view name,
+                         MeshUid          parentUid,
+                         MeshType         type,
+                         MeshCategory     cat,
+                         MeshModifier     mod) -> MeshRecord;
 
 private:
-  common::Result                          result_;     /// Parsing result & document validity
-  MeshRecords                             records_;    /// MeSH UID reference map
-  std::unique_ptr<termspp::common::Arena> allocator_;  /// Arena allocator
+  common::Result                                   result_;            /// Parsing result & document validity
+  MeshLoadMode                                     mode_;              /// Load strategy of this document
+  MeshRecords                                      records_;           /// MeSH UID reference map
+  MeshRecords                                      treeNumbers_;       /// Descriptor UID->`<TreeNumber />` map
+  MeshStore                                        store_;             /// MeSH record store & graph
+  MeshDictionary                                   dictionary_;        /// Normalised name->UID(s) dictionary
+  common::FlatMultiMap<MeshUid, bool, MeshUidHash> pendingUids_;       /// UID(s) touched since the store was built
+  MeshChildMap                                     pendingChildren_;   /// Child UID(s) inserted by pending updates
+  std::unique_ptr<termspp::common::Arena>          allocator_;         /// Arena allocator
+  std::vector<std::unique_ptr<common::MappedFile>> mappings_;          /// Mapped document(s), if any
+  std::vector<std::unique_ptr<common::Arena>>      sourceAllocators_;  /// Arena(s) owned by the loaded document(s)
+  size_t                                           liveBytes_{0};      /// Arena-owned text of live records
+  size_t                                           retiredBytes_{0};   /// Arena-owned text of removed records
 
 protected:
   /// MeSH document constructor
-  ///   - expects filepath to reference a valid XML document defining
+  ///   - expects the sources to reference valid XML documents defining
   ///     MeSH ontological terms
-  explicit MeshDocument(const char *filepath);
+  MeshDocument(const MeshSources &sources, MeshLoadMode mode, uint32_t threads);
+
+  /// MeSH snapshot document constructor
+  ///   - expects filepath to reference a snapshot written by `WriteSnapshot()`
+  MeshDocument(const char *filepath, bool verify);
 };
 
 }  // namespace mesh
@@ -0,0 +1,358 @@
+#include "termspp/mesh/reader.hpp"
+
+#include <cstring>
+
+namespace mesh = ::termspp::mesh;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Markup delimiters
+constexpr const std::string_view kCommentOpen  = "<!--";
+constexpr const std::string_view kCommentClose = "-->";
+constexpr const std::string_view kCdataOpen    = "<![CDATA[";
+constexpr const std::string_view kCdataClose   = "]]>";
+constexpr const std::string_view kInstrClose   = "?>";
+
+/// Test whether some char is considered whitespace by the XML spec
+constexpr auto isSpace(char chr) -> bool {
+  return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r';
+}
+
+/// Test whether the range starting at `ptr` begins with the given token
+auto startsWith(const char *ptr, const char *end, std::string_view token) -> bool {
+  return static_cast<size_t>(end - ptr) >= token.size() && std::memcmp(ptr, token.data(), token.size()) == 0;
+}
+
+/// Find the first occurrence of a token within the given range, returning `nullptr` if not found
+auto findToken(const char *ptr, const char *end, std::string_view token) -> const char * {
+  auto haystack = std::string_view{ptr, static_cast<size_t>(end - ptr)};
+  auto pos      = haystack.find(token);
+  return pos == std::string_view::npos ? nullptr : ptr + pos;
+}
+
+/// Skip a `<!DOCTYPE ...>` declaration, incl. its internal subset if any
+auto skipDeclaration(const char *ptr, const char *end) -> const char * {
+  int32_t depth{0};
+  for (; ptr < end; ++ptr) {
+    switch (*ptr) {
+    case '[':
+      depth++;
+      break;
+    case ']':
+      depth--;
+      break;
+    case '>':
+      if (depth <= 0) {
+        return ptr + 1;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  return nullptr;
+}
+
+/// Encode a unicode codepoint as UTF-8, returning the number of bytes written
+auto encodeCodepoint(uint32_t code, char *out) -> size_t {
+  if (code < 0x80) {
+    out[0] = static_cast<char>(code);
+    return 1;
+  }
+
+  if (code < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (code >> 6));
+    out[1] = static_cast<char>(0x80 | (code & 0x3F));
+    return 2;
+  }
+
+  if (code < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (code >> 12));
+    out[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (code & 0x3F));
+    return 3;
+  }
+
+  out[0] = static_cast<char>(0xF0 | (code >> 18));
+  out[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (code & 0x3F));
+  return 4;
+}
+
+/// Attempt to decode a single entity reference, e.g. `amp` or `#x00E9`, returning the number of bytes written
+auto decodeEntity(std::string_view ref, char *out) -> size_t {
+  if (ref == "amp") {
+    *out = '&';
+    return 1;
+  }
+  if (ref == "lt") {
+    *out = '<';
+    return 1;
+  }
+  if (ref == "gt") {
+    *out = '>';
+    return 1;
+  }
+  if (ref == "quot") {
+    *out = '"';
+    return 1;
+  }
+  if (ref == "apos") {
+    *out = '\'';
+    return 1;
+  }
+
+  if (ref.size() < 2 || ref.front() != '#') {
+    return 0;
+  }
+
+  uint32_t code{0};
+  uint32_t base{10};
+  ref.remove_prefix(1);
+  if (ref.front() == 'x' || ref.front() == 'X') {
+    base = 16;
+    ref.remove_prefix(1);
+  }
+
+  if (ref.empty() || ref.size() > 8) {
+    return 0;
+  }
+
+  for (const auto chr : ref) {
+    uint32_t digit{0};
+    if (chr >= '0' && chr <= '9') {
+      digit = static_cast<uint32_t>(chr - '0');
+    } else if (base == 16 && chr >= 'a' && chr <= 'f') {
+      digit = static_cast<uint32_t>(chr - 'a' + 10);
+    } else if (base == 16 && chr >= 'A' && chr <= 'F') {
+      digit = static_cast<uint32_t>(chr - 'A' + 10);
+    } else {
+      return 0;
+    }
+
+    code = code * base + digit;
+  }
+
+  if (code == 0 || code > 0x10FFFF) {
+    return 0;
+  }
+
+  return encodeCodepoint(code, out);
+}
+
+/************************************************************
+ *                                                          *
+ *                        XmlReader                         *
+ *                                                          *
+ ************************************************************/
+
+mesh::XmlReader::XmlReader(const char *begin, const char *end) : begin_(begin), cur_(begin), end_(end) {}
+
+mesh::XmlReader::XmlReader(std::string_view input) : XmlReader(input.data(), input.data() + input.size()) {}
+
+auto mesh::XmlReader::Next() -> mesh::XmlToken {
+  if (pendingEnd_) {
+    pendingEnd_ = false;
+    return XmlToken::kEndElement;
+  }
+
+  while (cur_ < end_) {
+    // Character data
+    if (*cur_ != '<') {
+      const auto *next = static_cast<const char *>(std::memchr(cur_, '<', static_cast<size_t>(end_ - cur_)));
+      next             = next == nullptr ? end_ : next;
+
+      text_    = std::string_view{cur_, static_cast<size_t>(next - cur_)};
+      isCdata_ = false;
+      cur_     = next;
+      return XmlToken::kText;
+    }
+
+    // Comments
+    if (startsWith(cur_, end_, kCommentOpen)) {
+      const auto *next = findToken(cur_ + kCommentOpen.size(), end_, kCommentClose);
+      if (next == nullptr) {
+        return XmlToken::kError;
+      }
+
+      cur_ = next + kCommentClose.size();
+      continue;
+    }
+
+    // CDATA sections
+    if (startsWith(cur_, end_, kCdataOpen)) {
+      const auto *start = cur_ + kCdataOpen.size();
+      const auto *next  = findToken(start, end_, kCdataClose);
+      if (next == nullptr) {
+        return XmlToken::kError;
+      }
+
+      text_    = std::string_view{start, static_cast<size_t>(next - start)};
+      isCdata_ = true;
+      cur_     = next + kCdataClose.size();
+      return XmlToken::kText;
+    }
+
+    if (cur_ + 1 >= end_) {
+      return XmlToken::kError;
+    }
+
+    // Processing instructions & declarations
+    if (cur_[1] == '?') {
+      const auto *next = findToken(cur_ + 2, end_, kInstrClose);
+      if (next == nullptr) {
+        return XmlToken::kError;
+      }
+
+      cur_ = next + kInstrClose.size();
+      continue;
+    }
+
+    if (cur_[1] == '!') {
+      const auto *next = skipDeclaration(cur_ + 2, end_);
+      if (next == nullptr) {
+        return XmlToken::kError;
+      }
+
+      cur_ = next;
+      continue;
+    }
+
+    // End elements
+    if (cur_[1] == '/') {
+      const auto *start = cur_ + 2;
+      const auto *next  = static_cast<const char *>(std::memchr(start, '>', static_cast<size_t>(end_ - start)));
+      if (next == nullptr) {
+        return XmlToken::kError;
+      }
+
+      const auto *tail = next;
+      while (tail > start && isSpace(*(tail - 1))) {
+        tail--;
+      }
+
+      name_ = std::string_view{start, static_cast<size_t>(tail - start)};
+      cur_  = next + 1;
+      return XmlToken::kEndElement;
+    }
+
+    // Start elements
+    const auto *start = cur_ + 1;
+    const auto *ptr   = start;
+    while (ptr < end_ && !isSpace(*ptr) && *ptr != '/' && *ptr != '>') {
+      ptr++;
+    }
+
+    name_ = std::string_view{start, static_cast<size_t>(ptr - start)};
+
+    const auto *attrs = ptr;
+    auto        quote = '\0';
+    for (; ptr < end_; ++ptr) {
+      if (quote != '\0') {
+        quote = *ptr == quote ? '\0' : quote;
+      } else if (*ptr == '"' || *ptr == '\'') {
+        quote = *ptr;
+      } else if (*ptr == '>') {
+        break;
+      }
+    }
+
+    if (ptr >= end_ || name_.empty()) {
+      return XmlToken::kError;
+    }
+
+    pendingEnd_ = *(ptr - 1) == '/';
+    attrs_      = std::string_view{attrs, static_cast<size_t>(ptr - attrs - (pendingEnd_ ? 1 : 0))};
+    cur_        = ptr + 1;
+    return XmlToken::kStartElement;
+  }
+
+  return XmlToken::kEnd;
+}
+
+auto mesh::XmlReader::Attribute(std::string_view key) const -> std::string_view {
+  const auto *ptr = attrs_.data();
+  const auto *end = ptr + attrs_.size();
+  while (ptr < end) {
+    while (ptr < end && isSpace(*ptr)) {
+      ptr++;
+    }
+
+    const auto *start = ptr;
+    while (ptr < end && !isSpace(*ptr) && *ptr != '=') {
+      ptr++;
+    }
+
+    const auto name = std::string_view{start, static_cast<size_t>(ptr - start)};
+    while (ptr < end && (isSpace(*ptr) || *ptr == '=')) {
+      ptr++;
+    }
+
+    if (ptr >= end || (*ptr != '"' && *ptr != '\'')) {
+      break;
+    }
+
+    const auto  quote = *ptr++;
+    const auto *value = ptr;
+    ptr               = static_cast<const char *>(std::memchr(value, quote, static_cast<size_t>(end - value)));
+    if (ptr == nullptr) {
+      break;
+    }
+
+    if (name == key) {
+      return std::string_view{value, static_cast<size_t>(ptr - value)};
+    }
+    ptr++;
+  }
+
+  return std::string_view{};
+}
+
+/************************************************************
+ *                                                          *
+ *                         Decoding                         *
+ *                                                          *
+ ************************************************************/
+
+auto mesh::HasEntities(std::string_view input) -> bool {
+  return input.find('&') != std::string_view::npos;
+}
+
+auto mesh::DecodeText(std::string_view input, char *out) -> size_t {
+  size_t length{0};
+  size_t index{0};
+  while (index < input.size()) {
+    const auto amp = input.find('&', index);
+    const auto run = (amp == std::string_view::npos ? input.size() : amp) - index;
+    if (run > 0) {
+      std::memmove(out + length, input.data() + index, run);
+      length += run;
+      index  += run;
+    }
+
+    if (amp == std::string_view::npos) {
+      break;
+    }
+
+    const auto semi = input.find(';', amp + 1);
+    if (semi != std::string_view::npos) {
+      const auto written = decodeEntity(input.substr(amp + 1, semi - amp - 1), out + length);
+      if (written > 0) {
+        length += written;
+        index   = semi + 1;
+        continue;
+      }
+    }
+
+    out[length++] = '&';
+    index         = amp + 1;
+  }
+
+  return length;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace termspp {
+namespace mesh {
+
+/// Token(s) emitted by the `mesh::XmlReader`
+enum class XmlToken : uint8_t {
+  kEnd,           // Reached the end of the buffer
+  kError,         // Malformed or truncated markup
+  kStartElement,  // Opening tag, e.g. `<Term LexicalTag="NON">`; self-closing tags emit a matching `kEndElement`
+  kEndElement,    // Closing tag, e.g. `</Term>`
+  kText,          // Character data between tags (incl. CDATA sections)
+};
+
+/// Pull-style XML tokenizer
+///   - Non-validating & non-allocating: operates over a contiguous, read-only buffer and only ever
+///     hands out views into it
+///   - Comments, processing instructions & DTD declarations are skipped
+///   - Text is returned raw, i.e. entity references are left for the consumer to decode via
+///     `mesh::DecodeText()` so that we only pay for decoding the nodes we're interested in
+///
+class XmlReader final {
+public:
+  XmlReader(const char *begin, const char *end);
+  explicit XmlReader(std::string_view input);
+
+  /// Advance to the next token
+  [[nodiscard]] auto Next() -> XmlToken;
+
+  /// Getter: the element name of the current start/end token
+  [[nodiscard]] auto Name() const -> std::string_view {
+    return name_;
+  }
+
+  /// Getter: the raw text of the current text token
+  [[nodiscard]] auto Text() const -> std::string_view {
+    return text_;
+  }
+
+  /// Getter: whether the current text token was declared within a CDATA section, i.e. shouldn't be decoded
+  [[nodiscard]] auto IsRawText() const -> bool {
+    return isCdata_;
+  }
+
+  /// Getter: the byte offset of the reader relative to the beginning of the buffer
+  [[nodiscard]] auto Offset() const -> size_t {
+    return static_cast<size_t>(cur_ - begin_);
+  }
+
+  /// Retrieve the raw value of the current start element's attribute, if any
+  ///   - returns an empty view if the attribute doesn't exist
+  [[nodiscard]] auto Attribute(std::string_view key) const -> std::string_view;
+
+private:
+  const char      *begin_;
+  const char      *cur_;
+  const char      *end_;
+  std::string_view name_;
+  std::string_view text_;
+  std::string_view attrs_;
+  bool             isCdata_{false};
+  bool             pendingEnd_{false};
+};
+
+/// Test whether some raw XML text contains any entity reference(s) that need decoding
+[[nodiscard]] auto HasEntities(std::string_view input) -> bool;
+
+/// Decodes the predefined & numeric XML entity references of some raw text into the output buffer
+///   - `out` is expected to be at least `input.size()` bytes as decoding never grows the input
+///   - unknown references are copied verbatim
+///   - returns the number of bytes written to `out`
+auto DecodeText(std::string_view input, char *out) -> size_t;
+
+}  // namespace mesh
+}  // namespace termspp
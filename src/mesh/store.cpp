@@ -0,0 +1,876 @@
+#include "termspp/mesh/store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace mesh   = ::termspp::mesh;
+namespace common = ::termspp::common;
+
+/************************************************************
+ *                                                          *
+ *                         Helpers                          *
+ *                                                          *
+ ************************************************************/
+
+/// Describes a parent->child edge between two rows
+struct MeshEdge {
+  uint32_t parent;  // Parent row index
+  uint32_t child;   // Child row index
+};
+
+/// Compresses a list of edges into CSR offsets & targets, keyed by the `source` projection of each edge
+template <typename Source, typename Target>
+auto compressEdges(const std::vector<MeshEdge> &edges,
+                   size_t                       rows,
+                   std::vector<uint32_t>       &offsets,
+                   std::vector<uint32_t>       &targets,
+                   Source                     &&source,
+                   Target                     &&target) -> void {
+  offsets.assign(rows + 1, 0);
+  for (const auto &edge : edges) {
+    offsets[source(edge) + 1]++;
+  }
+
+  for (size_t index = 0; index < rows; ++index) {
+    offsets[index + 1] += offsets[index];
+  }
+
+  auto cursor = std::vector<uint32_t>(offsets.begin(), offsets.end() - 1);
+  targets.resize(edges.size());
+  for (const auto &edge : edges) {
+    targets[cursor[source(edge)]++] = target(edge);
+  }
+}
+
+/// Test whether a tree number describes a strict descendant of another, e.g. `C04.557` is beneath `C04`
+constexpr auto isTreeDescendant(std::string_view ancestor, std::string_view treeNumber) -> bool {
+  return treeNumber.size() > ancestor.size() && treeNumber[ancestor.size()] == '.' &&
+         treeNumber.starts_with(ancestor);
+}
+
+/// ASCII case-folding of a single char
+constexpr auto foldChar(char chr) -> uint8_t {
+  const auto value = static_cast<uint8_t>(chr);
+  return value >= 'A' && value <= 'Z' ? value + ('a' - 'A') : value;
+}
+
+/// Three-way comparison of the case-folded form of two strings, optionally truncating `lhs` to the size of `rhs`
+///   - the truncated form is used to compare names against a prefix
+auto compareFolded(std::string_view lhs, std::string_view rhs, bool truncate = false) -> int {
+  const auto size = std::min(lhs.size(), rhs.size());
+  for (size_t index = 0; index < size; ++index) {
+    const auto lchr = foldChar(lhs[index]);
+    const auto rchr = foldChar(rhs[index]);
+    if (lchr != rchr) {
+      return lchr < rchr ? -1 : 1;
+    }
+  }
+
+  if (truncate && lhs.size() >= rhs.size()) {
+    return 0;
+  }
+
+  return lhs.size() == rhs.size() ? 0 : (lhs.size() < rhs.size() ? -1 : 1);
+}
+
+/// Describes the type-ahead weight of each MeSH type, lower is better
+constexpr auto nameWeight(mesh::MeshType type) -> uint32_t {
+  switch (type) {
+  case mesh::MeshType::kDescriptorRecord:
+    return 0;
+  case mesh::MeshType::kQualifierRecord:
+  case mesh::MeshType::kQualifier:
+    return 1;
+  case mesh::MeshType::kSupplementalRecord:
+    return 2;
+  case mesh::MeshType::kConcept:
+    return 3;
+  case mesh::MeshType::kTerm:
+    return 4;
+  default:
+    return 5;
+  }
+}
+
+/************************************************************
+ *                                                          *
+ *                         Snapshot                         *
+ *                                                          *
+ ************************************************************/
+
+/// Snapshot file signature
+constexpr const std::array<char, 8> kSnapshotMagic{'T', 'P', 'P', 'M', 'E', 'S', 'H', '\0'};
+
+/// Snapshot format version; must be incremented whenever the layout of the snapshot or its columns changes
+constexpr const uint32_t kSnapshotVersion{3U};
+
+/// Byte order marker used to reject snapshots written on a machine of a different endianness
+constexpr const uint32_t kSnapshotByteOrder{0x01020304U};
+
+/// Alignment of each snapshot section
+constexpr const size_t kSnapshotAlignment{8U};
+
+/// Minimum number of slots allocated by the UID->row table
+constexpr const size_t kMinSlots{16U};
+
+/// Snapshot sections, in the order they're laid out
+enum class SnapshotSection : uint8_t {
+  kUids,
+  kNameOffsets,
+  kTypes,
+  kCategories,
+  kModifiers,
+  kNames,
+  kParentOffsets,
+  kParents,
+  kChildOffsets,
+  kChildren,
+  kSlots,
+  kTreeOffsets,
+  kTreeNames,
+  kTreeRows,
+  kTreeEnds,
+  kRowTreeOffsets,
+  kRowTrees,
+  kNameOrder,
+  kNameRanks,
+  kNameMinima,
+  kSectionCount,
+};
+
+/// Describes the byte range of a snapshot section relative to the beginning of the snapshot
+struct SnapshotRange {
+  uint64_t offset;  // Offset of the section's first byte
+  uint64_t size;    // Size of the section in bytes, excl. padding
+};
+
+/// Snapshot file header
+struct SnapshotHeader {
+  std::array<char, 8> magic;      // Snapshot signature, see `kSnapshotMagic`
+  uint32_t            version;    // Snapshot format version, see `kSnapshotVersion`
+  uint32_t            byteOrder;  // Byte order marker, see `kSnapshotByteOrder`
+  uint64_t            rows;       // Number of rows contained by the store
+  uint64_t            checksum;   // Checksum of every byte following the header
+  uint64_t            length;     // Total size of the snapshot in bytes
+
+  std::array<SnapshotRange, static_cast<size_t>(SnapshotSection::kSectionCount)> sections;
+};
+
+/// Round some size up to the snapshot section alignment
+constexpr auto alignSection(uint64_t size) -> uint64_t {
+  return (size + kSnapshotAlignment - 1) & ~(kSnapshotAlignment - 1);
+}
+
+/// Word-wise checksum of some snapshot bytes
+///   - `bytes` is expected to be padded to a multiple of the section alignment
+auto updateChecksum(uint64_t hash, std::string_view bytes) -> uint64_t {
+  for (size_t offset = 0; offset + sizeof(uint64_t) <= bytes.size(); offset += sizeof(uint64_t)) {
+    uint64_t word{0};
+    std::memcpy(&word, bytes.data() + offset, sizeof(uint64_t));
+    hash = std::rotl((hash ^ word) * 0x9E3779B97F4A7C15ULL, 31) * 0xC2B2AE3D27D4EB4FULL;
+  }
+
+  return hash;
+}
+
+/// View the bytes of some column
+template <typename T>
+auto asBytes(std::span<const T> column) -> std::string_view {
+  return std::string_view{reinterpret_cast<const char *>(column.data()), column.size_bytes()};
+}
+
+/// View a snapshot section as a column of the given type
+template <typename T>
+auto asColumn(std::string_view bytes, const SnapshotRange &range) -> std::span<const T> {
+  return std::span<const T>{reinterpret_cast<const T *>(bytes.data() + range.offset), range.size / sizeof(T)};
+}
+
+/************************************************************
+ *                                                          *
+ *                        MeshStore                         *
+ *                                                          *
+ ************************************************************/
+
+struct mesh::MeshStore::Storage {
+  std::vector<MeshUid>      uids;
+  std::vector<uint32_t>     nameOffsets;
+  std::vector<MeshType>     types;
+  std::vector<MeshCategory> categories;
+  std::vector<MeshModifier> modifiers;
+  std::string               names;
+  std::vector<uint32_t>     parentOffsets;
+  std::vector<uint32_t>     parents;
+  std::vector<uint32_t>     childOffsets;
+  std::vector<uint32_t>     children;
+  std::vector<uint32_t>     slots;
+  std::vector<uint32_t>     treeOffsets;
+  std::string               treeNames;
+  std::vector<uint32_t>     treeRows;
+  std::vector<uint32_t>     treeEnds;
+  std::vector<uint32_t>     rowTreeOffsets;
+  std::vector<uint32_t>     rowTrees;
+  std::vector<uint32_t>     nameOrder;
+  std::vector<uint32_t>     nameRanks;
+  std::vector<uint32_t>     nameMinima;
+};
+
+mesh::MeshStore::MeshStore() = default;
+
+mesh::MeshStore::~MeshStore() = default;
+
+mesh::MeshStore::MeshStore(mesh::MeshStore &&) noexcept = default;
+
+auto mesh::MeshStore::operator=(mesh::MeshStore &&) noexcept -> mesh::MeshStore & = default;
+
+auto mesh::MeshStore::Build(const mesh::MeshRecords &records,
+                            const mesh::MeshRecords &trees /*= {}*/) -> mesh::MeshStore {
+  auto store     = mesh::MeshStore{};
+  store.storage_ = std::make_unique<Storage>();
+
+  auto      &data = *store.storage_;
+  const auto rows = records.KeyCount();
+  data.uids.reserve(rows);
+  data.nameOffsets.reserve(rows + 1);
+  data.types.reserve(rows);
+  data.categories.reserve(rows);
+  data.modifiers.reserve(rows);
+
+  auto slots = kMinSlots;
+  while (slots < rows * 2) {
+    slots *= 2;
+  }
+  data.slots.assign(slots, kNullRow);
+
+  // Assign rows in order of each UID's first occurrence
+  const auto mask = slots - 1;
+  for (const auto &[uid, record] : records) {
+    auto position = mesh::MeshUidHash{}(uid) & mask;
+    while (data.slots[position] != kNullRow && data.uids[data.slots[position]] != uid) {
+      position = (position + 1) & mask;
+    }
+
+    if (data.slots[position] != kNullRow) {
+      continue;
+    }
+
+    data.slots[position] = static_cast<uint32_t>(data.uids.size());
+    data.uids.emplace_back(uid);
+    data.nameOffsets.emplace_back(static_cast<uint32_t>(data.names.size()));
+    data.names.append(record.Name());
+    data.types.emplace_back(record.type);
+    data.categories.emplace_back(record.category);
+    data.modifiers.emplace_back(record.modifier);
+  }
+  data.nameOffsets.emplace_back(static_cast<uint32_t>(data.names.size()));
+  store.bindStorage();
+
+  // Resolve the unique parent->child edge(s) of every record
+  auto edges = std::vector<MeshEdge>{};
+  edges.reserve(records.Size());
+  for (const auto &[uid, record] : records) {
+    if (!record.parentUid.Valid()) {
+      continue;
+    }
+
+    const auto parent = store.Find(record.parentUid);
+    if (parent != kNullRow) {
+      edges.emplace_back(MeshEdge{.parent = parent, .child = store.Find(uid)});
+    }
+  }
+
+  std::sort(edges.begin(), edges.end(), [](const MeshEdge &lhs, const MeshEdge &rhs) {
+    return lhs.parent != rhs.parent ? lhs.parent < rhs.parent : lhs.child < rhs.child;
+  });
+
+  edges.erase(std::unique(edges.begin(),
+                          edges.end(),
+                          [](const MeshEdge &lhs, const MeshEdge &rhs) {
+                            return lhs.parent == rhs.parent && lhs.child == rhs.child;
+                          }),
+              edges.end());
+
+  // Since the edges are sorted by parent then child, both directions are emitted in ascending row order
+  compressEdges(
+    edges,
+    data.uids.size(),
+    data.childOffsets,
+    data.children,
+    [](const MeshEdge &edge) {
+      return edge.parent;
+    },
+    [](const MeshEdge &edge) {
+      return edge.child;
+    });
+
+  compressEdges(
+    edges,
+    data.uids.size(),
+    data.parentOffsets,
+    data.parents,
+    [](const MeshEdge &edge) {
+      return edge.child;
+    },
+    [](const MeshEdge &edge) {
+      return edge.parent;
+    });
+
+  // Sort the tree number(s) of every descriptor into pre-order
+  //   - since '.' sorts before any alphanumeric, lexicographic order places each tree number before its
+  //     descendants & after every subtree of its preceding sibling(s)
+  auto positions = std::vector<std::pair<std::string_view, uint32_t>>{};
+  positions.reserve(trees.Size());
+  for (const auto &[uid, record] : trees) {
+    const auto row = store.Find(uid);
+    if (row != kNullRow && record.nameLen > 0) {
+      positions.emplace_back(record.Name(), row);
+    }
+  }
+
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+  data.treeOffsets.reserve(positions.size() + 1);
+  data.treeRows.reserve(positions.size());
+  data.treeEnds.assign(positions.size(), static_cast<uint32_t>(positions.size()));
+  for (const auto &[treeNumber, row] : positions) {
+    data.treeOffsets.emplace_back(static_cast<uint32_t>(data.treeNames.size()));
+    data.treeNames.append(treeNumber);
+    data.treeRows.emplace_back(row);
+  }
+  data.treeOffsets.emplace_back(static_cast<uint32_t>(data.treeNames.size()));
+
+  // Label each position's subtree by the first position that isn't one of its descendants
+  auto ancestors = std::vector<uint32_t>{};
+  for (uint32_t position = 0; position < positions.size(); ++position) {
+    const auto treeNumber = positions[position].first;
+    while (!ancestors.empty() && !isTreeDescendant(positions[ancestors.back()].first, treeNumber)) {
+      data.treeEnds[ancestors.back()] = position;
+      ancestors.pop_back();
+    }
+    ancestors.emplace_back(position);
+  }
+
+  // Positions are visited in ascending order, i.e. each row's positions are emitted in ascending order
+  auto placements = std::vector<MeshEdge>{};
+  placements.reserve(positions.size());
+  for (uint32_t position = 0; position < positions.size(); ++position) {
+    placements.emplace_back(MeshEdge{.parent = positions[position].second, .child = position});
+  }
+
+  compressEdges(
+    placements,
+    data.uids.size(),
+    data.rowTreeOffsets,
+    data.rowTrees,
+    [](const MeshEdge &edge) {
+      return edge.parent;
+    },
+    [](const MeshEdge &edge) {
+      return edge.child;
+    });
+
+  // Index every named row by its case-folded name
+  for (uint32_t row = 0; row < data.uids.size(); ++row) {
+    if (data.nameOffsets[row + 1] > data.nameOffsets[row]) {
+      data.nameOrder.emplace_back(row);
+    }
+  }
+
+  std::sort(data.nameOrder.begin(), data.nameOrder.end(), [&store](uint32_t lhs, uint32_t rhs) {
+    const auto order = compareFolded(store.Name(lhs), store.Name(rhs));
+    return order != 0 ? order < 0 : lhs < rhs;
+  });
+
+  // Rank each entry by its type-ahead weight, then by the length of its name
+  const auto entries = static_cast<uint32_t>(data.nameOrder.size());
+  auto       ranking = std::vector<uint32_t>(entries);
+  for (uint32_t entry = 0; entry < entries; ++entry) {
+    ranking[entry] = entry;
+  }
+
+  auto key = [&](uint32_t entry) {
+    const auto row = data.nameOrder[entry];
+    return std::make_tuple(nameWeight(data.types[row]), data.nameOffsets[row + 1] - data.nameOffsets[row], entry);
+  };
+
+  std::sort(ranking.begin(), ranking.end(), [&](uint32_t lhs, uint32_t rhs) {
+    return key(lhs) < key(rhs);
+  });
+
+  data.nameRanks.resize(entries);
+  for (uint32_t rank = 0; rank < entries; ++rank) {
+    data.nameRanks[ranking[rank]] = rank;
+  }
+
+  // Sparse table of the best entry across each span of `2^level` blocks, stored with a stride of one block count
+  const auto blocks = (entries + kNameBlockSize - 1) / kNameBlockSize;
+  const auto levels = static_cast<uint32_t>(std::bit_width(blocks));
+  data.nameMinima.resize(static_cast<size_t>(levels) * blocks);
+  for (uint32_t block = 0; block < blocks; ++block) {
+    const auto first = block * kNameBlockSize;
+    const auto last  = std::min(first + kNameBlockSize, entries);
+
+    auto best = first;
+    for (auto entry = first + 1; entry < last; ++entry) {
+      best = data.nameRanks[entry] < data.nameRanks[best] ? entry : best;
+    }
+    data.nameMinima[block] = best;
+  }
+
+  for (uint32_t level = 1; level < levels; ++level) {
+    const auto *prev = data.nameMinima.data() + static_cast<size_t>(level - 1) * blocks;
+    auto       *curr = data.nameMinima.data() + static_cast<size_t>(level) * blocks;
+    const auto  span = 1U << (level - 1);
+    for (uint32_t block = 0; block < blocks; ++block) {
+      const auto lhs = prev[block];
+      const auto rhs = block + span < blocks ? prev[block + span] : lhs;
+      curr[block]    = data.nameRanks[rhs] < data.nameRanks[lhs] ? rhs : lhs;
+    }
+  }
+
+  store.bindStorage();
+  return store;
+}
+
+auto mesh::MeshStore::View(std::string_view bytes,
+                           bool             verify /*= true*/) -> nonstd::expected<mesh::MeshStore, common::Result> {
+  auto fail = [](const char *msg) {
+    return nonstd::make_unexpected(common::Result{common::Status::kSnapshotErr, msg});
+  };
+
+  if (bytes.size() < sizeof(SnapshotHeader) || reinterpret_cast<uintptr_t>(bytes.data()) % kSnapshotAlignment != 0) {
+    return fail("truncated or misaligned snapshot");
+  }
+
+  SnapshotHeader header{};
+  std::memcpy(&header, bytes.data(), sizeof(SnapshotHeader));
+  if (header.magic != kSnapshotMagic) {
+    return fail("unknown file signature");
+  }
+
+  if (header.version != kSnapshotVersion || header.byteOrder != kSnapshotByteOrder) {
+    return fail("incompatible snapshot version");
+  }
+
+  if (header.length != bytes.size() || header.rows >= kNullRow) {
+    return fail("truncated snapshot");
+  }
+
+  for (const auto &range : header.sections) {
+    if (range.offset % kSnapshotAlignment != 0 || range.offset < sizeof(SnapshotHeader) ||
+        range.offset > bytes.size() || range.size > bytes.size() - range.offset) {
+      return fail("section out of bounds");
+    }
+  }
+
+  if (verify) {
+    const auto payload = bytes.substr(sizeof(SnapshotHeader));
+    if (updateChecksum(0, payload) != header.checksum) {
+      return fail("checksum mismatch");
+    }
+  }
+
+  auto section = [&](SnapshotSection index) -> const SnapshotRange & {
+    return header.sections[static_cast<size_t>(index)];
+  };
+
+  auto store           = mesh::MeshStore{};
+  store.uids_          = asColumn<MeshUid>(bytes, section(SnapshotSection::kUids));
+  store.nameOffsets_   = asColumn<uint32_t>(bytes, section(SnapshotSection::kNameOffsets));
+  store.types_         = asColumn<MeshType>(bytes, section(SnapshotSection::kTypes));
+  store.categories_    = asColumn<MeshCategory>(bytes, section(SnapshotSection::kCategories));
+  store.modifiers_     = asColumn<MeshModifier>(bytes, section(SnapshotSection::kModifiers));
+  store.names_         = bytes.substr(section(SnapshotSection::kNames).offset, section(SnapshotSection::kNames).size);
+  store.parentOffsets_ = asColumn<uint32_t>(bytes, section(SnapshotSection::kParentOffsets));
+  store.parents_       = asColumn<uint32_t>(bytes, section(SnapshotSection::kParents));
+  store.childOffsets_  = asColumn<uint32_t>(bytes, section(SnapshotSection::kChildOffsets));
+  store.children_      = asColumn<uint32_t>(bytes, section(SnapshotSection::kChildren));
+  store.slots_         = asColumn<uint32_t>(bytes, section(SnapshotSection::kSlots));
+
+  const auto &tree_names = section(SnapshotSection::kTreeNames);
+  store.treeOffsets_     = asColumn<uint32_t>(bytes, section(SnapshotSection::kTreeOffsets));
+  store.treeNames_       = bytes.substr(tree_names.offset, tree_names.size);
+  store.treeRows_        = asColumn<uint32_t>(bytes, section(SnapshotSection::kTreeRows));
+  store.treeEnds_        = asColumn<uint32_t>(bytes, section(SnapshotSection::kTreeEnds));
+  store.rowTreeOffsets_  = asColumn<uint32_t>(bytes, section(SnapshotSection::kRowTreeOffsets));
+  store.rowTrees_        = asColumn<uint32_t>(bytes, section(SnapshotSection::kRowTrees));
+  store.nameOrder_       = asColumn<uint32_t>(bytes, section(SnapshotSection::kNameOrder));
+  store.nameRanks_       = asColumn<uint32_t>(bytes, section(SnapshotSection::kNameRanks));
+  store.nameMinima_      = asColumn<uint32_t>(bytes, section(SnapshotSection::kNameMinima));
+
+  // Ensure the columns agree with one another such that no accessor can read out of bounds
+  const auto rows = static_cast<size_t>(header.rows);
+  if (store.uids_.size() != rows || store.types_.size() != rows || store.categories_.size() != rows ||
+      store.modifiers_.size() != rows || store.nameOffsets_.size() != rows + 1 ||
+      store.parentOffsets_.size() != rows + 1 || store.childOffsets_.size() != rows + 1 ||
+      store.nameOffsets_.back() != store.names_.size() || store.parentOffsets_.back() != store.parents_.size() ||
+      store.childOffsets_.back() != store.children_.size() || !std::has_single_bit(store.slots_.size()) ||
+      store.slots_.size() <= rows) {
+    return fail("inconsistent columns");
+  }
+
+  const auto positions = store.treeRows_.size();
+  if (store.treeOffsets_.size() != positions + 1 || store.treeEnds_.size() != positions ||
+      store.rowTreeOffsets_.size() != rows + 1 || store.rowTrees_.size() != positions ||
+      store.treeOffsets_.back() != store.treeNames_.size() || store.rowTreeOffsets_.back() != positions) {
+    return fail("inconsistent tree columns");
+  }
+
+  const auto entries = store.nameOrder_.size();
+  const auto blocks  = (entries + kNameBlockSize - 1) / kNameBlockSize;
+  if (entries > rows || store.nameRanks_.size() != entries ||
+      store.nameMinima_.size() != static_cast<size_t>(std::bit_width(blocks)) * blocks) {
+    return fail("inconsistent name index columns");
+  }
+
+  return store;
+}
+
+auto mesh::MeshStore::Write(std::FILE *file) const -> common::Result {
+  if (file == nullptr) {
+    return common::Result{common::Status::kInvalidArguments, "expected a valid file handle"};
+  }
+
+  const auto columns = std::array<std::string_view, static_cast<size_t>(SnapshotSection::kSectionCount)>{
+    asBytes(uids_),
+    asBytes(nameOffsets_),
+    asBytes(types_),
+    asBytes(categories_),
+    asBytes(modifiers_),
+    names_,
+    asBytes(parentOffsets_),
+    asBytes(parents_),
+    asBytes(childOffsets_),
+    asBytes(children_),
+    asBytes(slots_),
+    asBytes(treeOffsets_),
+    treeNames_,
+    asBytes(treeRows_),
+    asBytes(treeEnds_),
+    asBytes(rowTreeOffsets_),
+    asBytes(rowTrees_),
+    asBytes(nameOrder_),
+    asBytes(nameRanks_),
+    asBytes(nameMinima_),
+  };
+
+  // Lay out & checksum each section, incl. its zeroed padding
+  const auto padding = std::array<char, kSnapshotAlignment>{};
+
+  auto header      = SnapshotHeader{};
+  header.magic     = kSnapshotMagic;
+  header.version   = kSnapshotVersion;
+  header.byteOrder = kSnapshotByteOrder;
+  header.rows      = Size();
+
+  auto     hash   = uint64_t{0};
+  uint64_t offset = alignSection(sizeof(SnapshotHeader));
+  for (size_t index = 0; index < columns.size(); ++index) {
+    const auto &column = columns[index];
+    const auto  tail   = column.size() % kSnapshotAlignment;
+    const auto  body   = column.size() - tail;
+
+    // Hash the aligned body in place, then the remainder alongside its padding
+    auto last = std::array<char, kSnapshotAlignment>{};
+    std::memcpy(last.data(), column.data() + body, tail);
+    hash = updateChecksum(hash, column.substr(0, body));
+    hash = tail > 0 ? updateChecksum(hash, std::string_view{last.data(), last.size()}) : hash;
+
+    header.sections[index] = SnapshotRange{.offset = offset, .size = column.size()};
+    offset                += alignSection(column.size());
+  }
+  header.checksum = hash;
+  header.length   = offset;
+
+  // Write the header, then each section
+  auto write = [&](const void *data, size_t size) -> bool {
+    return size == 0 || std::fwrite(data, 1, size, file) == size;
+  };
+
+  auto success = write(&header, sizeof(SnapshotHeader)) &&
+                 write(padding.data(), alignSection(sizeof(SnapshotHeader)) - sizeof(SnapshotHeader));
+  for (size_t index = 0; success && index < columns.size(); ++index) {
+    const auto &column = columns[index];
+    success            = write(column.data(), column.size()) &&
+              write(padding.data(), alignSection(column.size()) - column.size());
+  }
+
+  if (!success || std::fflush(file) != 0) {
+    return common::Result{common::Status::kFileWriteErr, "failed to write snapshot"};
+  }
+
+  return common::Result{common::Status::kSuccessful};
+}
+
+auto mesh::MeshStore::Find(mesh::MeshUid uid) const -> uint32_t {
+  if (slots_.empty()) {
+    return kNullRow;
+  }
+
+  const auto mask     = slots_.size() - 1;
+  auto       position = mesh::MeshUidHash{}(uid) & mask;
+  for (size_t probes = 0; probes < slots_.size(); ++probes, position = (position + 1) & mask) {
+    const auto row = slots_[position];
+    if (row == kNullRow || (row < uids_.size() && uids_[row] == uid)) {
+      return row < uids_.size() ? row : kNullRow;
+    }
+  }
+
+  return kNullRow;
+}
+
+auto mesh::MeshStore::FindAll(std::span<const mesh::MeshUid> uids, std::span<uint32_t> rows) const -> void {
+  const auto count = std::min(uids.size(), rows.size());
+  if (slots_.empty()) {
+    std::fill_n(rows.begin(), count, kNullRow);
+    return;
+  }
+
+  // Prefetch the home slot of each UID
+  const auto mask = slots_.size() - 1;
+  for (size_t index = 0; index < count; ++index) {
+    __builtin_prefetch(&slots_[mesh::MeshUidHash{}(uids[index]) & mask]);
+  }
+
+  // Read each home slot & prefetch the UID of its row, if any
+  for (size_t index = 0; index < count; ++index) {
+    const auto row = slots_[mesh::MeshUidHash{}(uids[index]) & mask];
+    if (row < uids_.size()) {
+      __builtin_prefetch(&uids_[row]);
+    }
+
+    rows[index] = row;
+  }
+
+  // Resolve each UID, only probing beyond its home slot on collision
+  for (size_t index = 0; index < count; ++index) {
+    const auto row = rows[index];
+    if (row == kNullRow || (row < uids_.size() && uids_[row] == uids[index])) {
+      rows[index] = row < uids_.size() ? row : kNullRow;
+      continue;
+    }
+
+    rows[index] = Find(uids[index]);
+  }
+}
+
+auto mesh::MeshStore::FindTreeNumber(std::string_view treeNumber) const -> uint32_t {
+  // Binary search over the positions, which are sorted by their tree number
+  uint32_t lower{0};
+  uint32_t upper{static_cast<uint32_t>(TreeSize())};
+  while (lower < upper) {
+    const auto middle = lower + (upper - lower) / 2;
+    if (TreeNumber(middle) < treeNumber) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+
+  return lower < TreeSize() && TreeNumber(lower) == treeNumber ? lower : kNullRow;
+}
+
+auto mesh::MeshStore::IsDescendantOf(uint32_t row, uint32_t ancestor) const -> bool {
+  if (row >= Size() || ancestor >= Size()) {
+    return false;
+  }
+
+  const auto positions = TreePositions(row);
+  for (const auto position : TreePositions(ancestor)) {
+    if (isUnderPosition(positions, position)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+auto mesh::MeshStore::IsUnderTree(uint32_t row, uint32_t position) const -> bool {
+  if (row >= Size() || position >= TreeSize()) {
+    return false;
+  }
+
+  return isUnderPosition(TreePositions(row), position);
+}
+
+auto mesh::MeshStore::CollectSubtree(uint32_t row, std::vector<uint32_t> &out) const -> void {
+  if (row >= Size()) {
+    return;
+  }
+
+  // A row may occupy several position(s) within the same subtree, e.g. if its positions are nested
+  auto visited = std::vector<bool>(Size(), false);
+  visited[row] = true;
+  for (const auto position : TreePositions(row)) {
+    if (position >= TreeSize()) {
+      continue;
+    }
+
+    for (const auto next : Subtree(position)) {
+      if (next < Size() && !visited[next]) {
+        visited[next] = true;
+        out.emplace_back(next);
+      }
+    }
+  }
+}
+
+auto mesh::MeshStore::CompletePrefix(std::string_view       prefix,
+                                     size_t                 limit,
+                                     std::vector<uint32_t> &out) const -> void {
+  if (limit == 0 || nameOrder_.empty()) {
+    return;
+  }
+
+  // Resolve the range of entries beginning with the prefix
+  auto compare = [this](uint32_t row, std::string_view text) {
+    return row < Size() ? compareFolded(Name(row), text, true) : 1;
+  };
+
+  const auto lower = std::partition_point(nameOrder_.begin(), nameOrder_.end(), [&](uint32_t row) {
+    return compare(row, prefix) < 0;
+  });
+
+  const auto upper = std::partition_point(lower, nameOrder_.end(), [&](uint32_t row) {
+    return compare(row, prefix) == 0;
+  });
+
+  if (lower == upper) {
+    return;
+  }
+
+  // Select the best entries by repeatedly splitting the range around its best entry
+  struct Candidate {
+    uint32_t rank;   // Rank of the range's best entry
+    uint32_t entry;  // Index of the range's best entry
+    uint32_t first;  // First entry of the range
+    uint32_t last;   // Exclusive end of the range
+  };
+
+  auto heap = std::vector<Candidate>{};
+  auto push = [&](uint32_t first, uint32_t last) {
+    if (first < last) {
+      const auto entry = bestName(first, last);
+      heap.emplace_back(Candidate{.rank = nameRanks_[entry], .entry = entry, .first = first, .last = last});
+      std::push_heap(heap.begin(), heap.end(), [](const Candidate &lhs, const Candidate &rhs) {
+        return lhs.rank > rhs.rank;
+      });
+    }
+  };
+
+  push(static_cast<uint32_t>(lower - nameOrder_.begin()), static_cast<uint32_t>(upper - nameOrder_.begin()));
+  for (size_t count = 0; count < limit && !heap.empty(); ++count) {
+    std::pop_heap(heap.begin(), heap.end(), [](const Candidate &lhs, const Candidate &rhs) {
+      return lhs.rank > rhs.rank;
+    });
+
+    const auto next = heap.back();
+    heap.pop_back();
+
+    out.emplace_back(nameOrder_[next.entry]);
+    push(next.first, next.entry);
+    push(next.entry + 1, next.last);
+  }
+}
+
+auto mesh::MeshStore::CollectAncestors(uint32_t row, std::vector<uint32_t> &out) const -> void {
+  collect(row, out, [this](uint32_t index) {
+    return Parents(index);
+  });
+}
+
+auto mesh::MeshStore::CollectDescendants(uint32_t row, std::vector<uint32_t> &out) const -> void {
+  collect(row, out, [this](uint32_t index) {
+    return Children(index);
+  });
+}
+
+template <typename Edges>
+auto mesh::MeshStore::collect(uint32_t row, std::vector<uint32_t> &out, Edges &&edges) const -> void {
+  if (row >= Size()) {
+    return;
+  }
+
+  // Breadth-first walk; the frontier is the tail of `out` that hasn't been visited yet
+  auto visited = std::vector<bool>(Size(), false);
+  auto cursor  = out.size();
+  visited[row] = true;
+  out.reserve(out.size() + edges(row).size());
+
+  auto visit = [&](uint32_t index) {
+    for (const auto next : edges(index)) {
+      if (next < Size() && !visited[next]) {
+        visited[next] = true;
+        out.emplace_back(next);
+      }
+    }
+  };
+
+  visit(row);
+  while (cursor < out.size()) {
+    visit(out[cursor++]);
+  }
+}
+
+auto mesh::MeshStore::bestName(uint32_t first, uint32_t last) const -> uint32_t {
+  auto best = first;
+  auto scan = [&](uint32_t from, uint32_t to) {
+    for (auto entry = from; entry < to; ++entry) {
+      best = nameRanks_[entry] < nameRanks_[best] ? entry : best;
+    }
+  };
+
+  // Scan the partial block(s) at either end, then consult the sparse table across the whole block(s) between
+  const auto head = (first + kNameBlockSize - 1) / kNameBlockSize;
+  const auto tail = last / kNameBlockSize;
+  if (head >= tail) {
+    scan(first, last);
+    return best;
+  }
+
+  scan(first, head * kNameBlockSize);
+  scan(tail * kNameBlockSize, last);
+
+  const auto blocks = (nameOrder_.size() + kNameBlockSize - 1) / kNameBlockSize;
+  const auto level  = static_cast<uint32_t>(std::bit_width(tail - head)) - 1;
+  const auto *table = nameMinima_.data() + level * blocks;
+  for (const auto entry : {table[head], table[tail - (1U << level)]}) {
+    best = nameRanks_[entry] < nameRanks_[best] ? entry : best;
+  }
+
+  return best;
+}
+
+auto mesh::MeshStore::isUnderPosition(std::span<const uint32_t> positions, uint32_t ancestor) const -> bool {
+  // Positions are sorted, i.e. the first position following the ancestor decides whether it's in the interval
+  const auto iter = std::upper_bound(positions.begin(), positions.end(), ancestor);
+  return iter != positions.end() && *iter < treeEnds_[ancestor];
+}
+
+auto mesh::MeshStore::bindStorage() -> void {
+  const auto &data = *storage_;
+  uids_            = data.uids;
+  nameOffsets_     = data.nameOffsets;
+  types_           = data.types;
+  categories_      = data.categories;
+  modifiers_       = data.modifiers;
+  names_           = data.names;
+  parentOffsets_   = data.parentOffsets;
+  parents_         = data.parents;
+  childOffsets_    = data.childOffsets;
+  children_        = data.children;
+  slots_           = data.slots;
+  treeOffsets_     = data.treeOffsets;
+  treeNames_       = data.treeNames;
+  treeRows_        = data.treeRows;
+  treeEnds_        = data.treeEnds;
+  rowTreeOffsets_  = data.rowTreeOffsets;
+  rowTrees_        = data.rowTrees;
+  nameOrder_       = data.nameOrder;
+  nameRanks_       = data.nameRanks;
+  nameMinima_      = data.nameMinima;
+}
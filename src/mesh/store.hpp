@@ -0,0 +1,235 @@
+#pragma once
+
+#include "termspp/common/flatmap.hpp"
+#include "termspp/common/result.hpp"
+#include "termspp/mesh/defs.hpp"
+
+#include "nonstd/expected.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace termspp {
+namespace mesh {
+
+/// Uid reference map type
+///   - open-addressing multimap such that each UID resolves to a contiguous array of its record(s), e.g. in the
+///     case of an `<AllowableQualifier />` referenced by multiple descriptors
+typedef common::FlatMultiMap<MeshUid, MeshRecord, MeshUidHash> MeshRecords;
+
+/// Struct-of-arrays MeSH record store
+///   - each unique UID is assigned a dense row index, in order of its first occurrence within the document;
+///     the row's columns describe the first record assoc. with the UID
+///   - the descriptor->concept->term & descriptor->qualifier links are stored as a compressed sparse row (CSR)
+///     adjacency in both directions, i.e. a row's parents & children are a contiguous range of row indices
+///     sorted in ascending order
+///   - UIDs are resolved to rows by a linear probing table of row indices
+///   - each descriptor's `<TreeNumber />`(s) are stored as positions within the MeSH polyhierarchy, sorted in
+///     pre-order, such that each position's subtree is the contiguous range `[position, TreeEnd(position))`;
+///     i.e. subsumption is an interval test & a subtree's rows can be enumerated without walking the graph
+///   - rows are indexed by name for type-ahead, see `CompletePrefix()`
+///   - every column is a view, either of the store's own storage or of a snapshot written by `Write()`, such that
+///     a snapshot can be queried in place without parsing or allocating
+///
+class MeshStore final {
+  /// Owned column storage of a store built from records
+  struct Storage;
+
+public:
+  /// Row sentinel describing a UID that doesn't exist within the store
+  static constexpr const uint32_t kNullRow = std::numeric_limits<uint32_t>::max();
+
+  /// Number of name index entries summarised by each block of the name index's range-minimum table
+  static constexpr const uint32_t kNameBlockSize = 64U;
+
+public:
+  MeshStore();
+  ~MeshStore();
+
+  MeshStore(MeshStore &&) noexcept;
+  auto operator=(MeshStore &&) noexcept -> MeshStore &;
+
+  MeshStore(MeshStore const &)                   = delete;
+  auto operator=(MeshStore const &)->MeshStore & = delete;
+
+  /// Builds the store from the records of a MeSH document
+  ///   - `trees` maps each descriptor's UID to its `MeshType::kTreeNumber` record(s), if any
+  [[nodiscard]] static auto Build(const MeshRecords &records, const MeshRecords &trees = {}) -> MeshStore;
+
+  /// Attempt to view a snapshot written by `Write()`
+  ///   - the store references `bytes`, i.e. it's only valid for the lifetime of the underlying buffer
+  ///   - `bytes` is expected to be aligned to at least 8 bytes, e.g. a memory-mapped file
+  ///   - the snapshot's checksum is only validated if `verify` is set, which touches every page of the snapshot
+  [[nodiscard]] static auto View(std::string_view bytes,
+                                 bool             verify = true) -> nonstd::expected<MeshStore, common::Result>;
+
+  /// Write a versioned & checksummed snapshot of this store to the given file
+  auto Write(std::FILE *file) const -> common::Result;
+
+  /// Getter: the number of rows contained by this store
+  [[nodiscard]] auto Size() const -> size_t {
+    return uids_.size();
+  }
+
+  /// Getter: whether this store contains any rows
+  [[nodiscard]] auto Empty() const -> bool {
+    return uids_.empty();
+  }
+
+  /// Find the row assoc. with the given UID, returning `kNullRow` if it doesn't exist
+  [[nodiscard]] auto Find(MeshUid uid) const -> uint32_t;
+
+  /// Find the rows assoc. with a batch of UIDs, see `Find()`
+  ///   - the home slot of every UID is prefetched, & then the UID column of every occupied slot, before any UID is
+  ///     resolved such that the cache misses of the batch overlap rather than being paid one after another
+  ///   - `rows` is expected to be sized to at least `uids.size()`; never allocates
+  auto FindAll(std::span<const MeshUid> uids, std::span<uint32_t> rows) const -> void;
+
+  /// Getter: the UID of the given row
+  [[nodiscard]] auto Uid(uint32_t row) const -> MeshUid {
+    return uids_[row];
+  }
+
+  /// Getter: view the name of the given row
+  [[nodiscard]] auto Name(uint32_t row) const -> std::string_view {
+    const auto offset = nameOffsets_[row];
+    return names_.substr(offset, nameOffsets_[row + 1] - offset);
+  }
+
+  /// Getter: the MeSH element type of the given row
+  [[nodiscard]] auto Type(uint32_t row) const -> MeshType {
+    return types_[row];
+  }
+
+  /// Getter: the MeSH category of the given row
+  [[nodiscard]] auto Category(uint32_t row) const -> MeshCategory {
+    return categories_[row];
+  }
+
+  /// Getter: the MeSH modifier of the given row
+  [[nodiscard]] auto Modifier(uint32_t row) const -> MeshModifier {
+    return modifiers_[row];
+  }
+
+  /// Getter: the parent row(s) of the given row
+  [[nodiscard]] auto Parents(uint32_t row) const -> std::span<const uint32_t> {
+    const auto offset = parentOffsets_[row];
+    return parents_.subspan(offset, parentOffsets_[row + 1] - offset);
+  }
+
+  /// Getter: the child row(s) of the given row
+  [[nodiscard]] auto Children(uint32_t row) const -> std::span<const uint32_t> {
+    const auto offset = childOffsets_[row];
+    return children_.subspan(offset, childOffsets_[row + 1] - offset);
+  }
+
+  /// Getter: the number of tree positions contained by this store
+  [[nodiscard]] auto TreeSize() const -> size_t {
+    return treeRows_.size();
+  }
+
+  /// Getter: view the tree number of the given position, e.g. `C04.557.337`
+  [[nodiscard]] auto TreeNumber(uint32_t position) const -> std::string_view {
+    const auto offset = treeOffsets_[position];
+    return treeNames_.substr(offset, treeOffsets_[position + 1] - offset);
+  }
+
+  /// Getter: the row assoc. with the given tree position
+  [[nodiscard]] auto TreeRow(uint32_t position) const -> uint32_t {
+    return treeRows_[position];
+  }
+
+  /// Getter: the (exclusive) end of the given position's subtree
+  [[nodiscard]] auto TreeEnd(uint32_t position) const -> uint32_t {
+    return treeEnds_[position];
+  }
+
+  /// Getter: the tree position(s) of the given row in ascending order
+  [[nodiscard]] auto TreePositions(uint32_t row) const -> std::span<const uint32_t> {
+    const auto offset = rowTreeOffsets_[row];
+    return rowTrees_.subspan(offset, rowTreeOffsets_[row + 1] - offset);
+  }
+
+  /// Getter: the row(s) of the given position's subtree in pre-order, incl. the position's own row
+  ///   - a row appears once per position it occupies within the subtree
+  [[nodiscard]] auto Subtree(uint32_t position) const -> std::span<const uint32_t> {
+    return treeRows_.subspan(position, treeEnds_[position] - position);
+  }
+
+  /// Find the position of the given tree number, returning `kNullRow` if it doesn't exist
+  [[nodiscard]] auto FindTreeNumber(std::string_view treeNumber) const -> uint32_t;
+
+  /// Test whether a row is a strict descendant of another within the MeSH tree(s)
+  ///   - cost is bounded by the product of each row's tree position count
+  [[nodiscard]] auto IsDescendantOf(uint32_t row, uint32_t ancestor) const -> bool;
+
+  /// Test whether a row occupies a strict descendant of the given tree position
+  [[nodiscard]] auto IsUnderTree(uint32_t row, uint32_t position) const -> bool;
+
+  /// Collects every row beneath the given row's tree position(s), excl. the row itself
+  ///   - rows are appended to `out` in pre-order, each at most once
+  auto CollectSubtree(uint32_t row, std::vector<uint32_t> &out) const -> void;
+
+  /// Collects the best `limit` rows whose name begins with the given prefix
+  ///   - names are compared case-insensitively, ASCII only
+  ///   - rows are appended to `out` from best to worst, where records are ranked by their type (descriptors,
+  ///     qualifiers, supplementals, concepts then terms), then by the length of their name
+  ///   - the matching range is found by binary search over the rows sorted by name, and its best rows are
+  ///     selected by a block-wise range-minimum table such that the cost is independent of the range's size
+  auto CompletePrefix(std::string_view prefix, size_t limit, std::vector<uint32_t> &out) const -> void;
+
+  /// Collects every ancestor of the given row, i.e. its parent(s), their parent(s) etc.
+  ///   - ancestors are appended to `out` in breadth-first order, each at most once
+  auto CollectAncestors(uint32_t row, std::vector<uint32_t> &out) const -> void;
+
+  /// Collects every descendant of the given row, i.e. its child(ren), their child(ren) etc.
+  ///   - descendants are appended to `out` in breadth-first order, each at most once
+  auto CollectDescendants(uint32_t row, std::vector<uint32_t> &out) const -> void;
+
+private:
+  /// Tandem function alongside `CollectAncestors()` & `CollectDescendants()` to walk the graph
+  template <typename Edges>
+  auto collect(uint32_t row, std::vector<uint32_t> &out, Edges &&edges) const -> void;
+
+  /// Find the index entry with the best rank within the given range of the name index
+  [[nodiscard]] auto bestName(uint32_t first, uint32_t last) const -> uint32_t;
+
+  /// Test whether any of the given sorted position(s) lies strictly within the ancestor's subtree
+  [[nodiscard]] auto isUnderPosition(std::span<const uint32_t> positions, uint32_t ancestor) const -> bool;
+
+  /// Points each column at the store's own storage
+  auto bindStorage() -> void;
+
+private:
+  std::span<const MeshUid>      uids_;            /// UID column
+  std::span<const uint32_t>     nameOffsets_;     /// Name column; offsets into `names_`, sized `Size() + 1`
+  std::span<const MeshType>     types_;           /// MeSH element type column
+  std::span<const MeshCategory> categories_;      /// MeSH category column
+  std::span<const MeshModifier> modifiers_;       /// MeSH modifier column
+  std::string_view              names_;           /// Contiguous name pool
+  std::span<const uint32_t>     parentOffsets_;   /// CSR offsets into `parents_`, sized `Size() + 1`
+  std::span<const uint32_t>     parents_;         /// CSR parent row indices
+  std::span<const uint32_t>     childOffsets_;    /// CSR offsets into `children_`, sized `Size() + 1`
+  std::span<const uint32_t>     children_;        /// CSR child row indices
+  std::span<const uint32_t>     slots_;           /// UID->row linear probing table, sized to a power of two
+  std::span<const uint32_t>     treeOffsets_;     /// Tree number column; offsets into `treeNames_`
+  std::string_view              treeNames_;       /// Contiguous tree number pool, in pre-order
+  std::span<const uint32_t>     treeRows_;        /// Row of each tree position
+  std::span<const uint32_t>     treeEnds_;        /// Exclusive end of each tree position's subtree
+  std::span<const uint32_t>     rowTreeOffsets_;  /// CSR offsets into `rowTrees_`, sized `Size() + 1`
+  std::span<const uint32_t>     rowTrees_;        /// CSR tree positions of each row
+  std::span<const uint32_t>     nameOrder_;       /// Name index; rows sorted by their case-folded name
+  std::span<const uint32_t>     nameRanks_;       /// Rank of each name index entry, lower is better
+  std::span<const uint32_t>     nameMinima_;      /// Sparse table of best entries across spans of name blocks
+  std::unique_ptr<Storage>      storage_;         /// Owned storage, if this store isn't viewing a snapshot
+};
+
+}  // namespace mesh
+}  // namespace termspp